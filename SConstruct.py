@@ -10,31 +10,93 @@ from miniscons import (
     packages,
     flags,
 )
+from SCons.Script import ARGUMENTS
 from walkmate import tree
 
 env = conan()
 
+instrument = ["-DPLANAR_INSTRUMENT"] if ARGUMENTS.get("instrument") == "1" else []
+
+sources = tree("src", r"(?<!\.spec)(?<!\.bench)\.cpp$", ["test.cpp", "bench.cpp"])
+
+benches = tree("src", r"\.bench\.cpp$")
+
+lto = [*flags("c++20"), *instrument, "-O3", "-flto"]
+
+benchmark = packages(["benchmark"])
+
 runtime = Build(
     "build",
-    tree("src", r"(?<!\.spec)\.cpp$", ["test.cpp"]),
-    flags("c++20"),
+    sources,
+    [*flags("c++20"), *instrument],
     shared=True,
     rename="planar",
 )
 
+static = env.Alias(
+    "static",
+    env.StaticLibrary(
+        "dist/static/planar",
+        [env.Object(f"build/static/{i[:-4]}.o", i, CXXFLAGS=lto) for i in sources],
+        AR="gcc-ar",
+        RANLIB="gcc-ranlib",
+    ),
+)
+
 tests = Build(
     "tests",
-    tree("src", r"\.cpp$"),
-    flags("c++20"),
+    tree("src", r"(?<!\.bench)\.cpp$", ["bench.cpp"]),
+    [*flags("c++20"), *instrument],
     packages(["gtest"]),
 )
 
+benchmarks = Build(
+    "benchmarks",
+    [*sources, *benches, "src/bench.cpp"],
+    lto,
+    benchmark,
+)
+
+benchmarks_shared = env.Alias(
+    "benchmarks-shared",
+    env.Program(
+        "dist/benchmarks-shared",
+        [
+            env.Object(
+                f"build/shared/{i[:-4]}.o",
+                i,
+                CXXFLAGS=[*flags("c++20"), *instrument, "-O3"],
+                CPPPATH=benchmark["CPPPATH"],
+            )
+            for i in [*benches, "src/bench.cpp"]
+        ],
+        LIBS=["planar", *benchmark["LIBS"], "fmt", "pthread"],
+        LIBPATH=["dist", *benchmark["LIBPATH"]],
+        RPATH=["dist"],
+    ),
+)
+
 test = Target(
     "test",
     tests,
     ["--gtest_brief"],
 )
 
+bench = Target(
+    "bench",
+    benchmarks,
+    [
+        "--benchmark_counters_tabular=true",
+        "--benchmark_out=dist/benchmarks.json",
+        "--benchmark_out_format=json",
+    ],
+)
+
+compare = Script(
+    "compare",
+    ["python", "scripts/compare.py", "dist/benchmarks.json", "benchmarks/baseline.json"],
+)
+
 includes = tests.packages["CPPPATH"]
 
 cspell = Script(
@@ -113,9 +175,9 @@ docs = Routine(
 )
 
 cli = Tasks(
-    [runtime, tests],
-    [test],
-    [*lint.scripts, *fmt.scripts, *docs.scripts, clang_tidy],
+    [runtime, tests, benchmarks],
+    [test, bench],
+    [*lint.scripts, *fmt.scripts, *docs.scripts, clang_tidy, compare],
     [lint, fmt, docs],
 )
 
@@ -18,3 +18,4 @@ class PlanarConan(ConanFile):
 
     def build_requirements(self):
         self.test_requires("gtest/1.12.1")
+        self.test_requires("benchmark/1.9.1")
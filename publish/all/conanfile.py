@@ -31,6 +31,16 @@ class PlanarConan(ConanFile):
         "build_type",
     )
 
+    options = {
+        "lto": [True, False],
+        "instrument": [True, False],
+    }
+
+    default_options = {
+        "lto": False,
+        "instrument": False,
+    }
+
     exports_sources = (
         "src/*.[cht]pp",
         "conanfile.py",
@@ -58,9 +68,12 @@ class PlanarConan(ConanFile):
 
     def build_requirements(self):
         self.test_requires("gtest/1.12.1")
+        self.test_requires("benchmark/1.9.1")
 
     def build(self):
-        self.run("scons build", cwd="..")
+        target = "static" if self.options.lto else "build"
+        flag = "instrument=1" if self.options.instrument else "instrument=0"
+        self.run(f"scons {target} {flag}", cwd="..")
 
     def package(self):
         copy(
@@ -80,8 +93,24 @@ class PlanarConan(ConanFile):
             "*.a",
             os.path.join(self.build_folder, "..", "dist"),
             os.path.join(self.package_folder, "lib"),
+            keep_path=False,
+        )
+        copy(
+            self,
+            "*.so",
+            os.path.join(self.build_folder, "..", "dist"),
+            os.path.join(self.package_folder, "lib"),
+            keep_path=False,
         )
 
     def package_info(self):
         self.cpp_info.bindirs = []
         self.cpp_info.libs = [self.name]
+
+        if self.options.instrument:
+            self.cpp_info.defines = ["PLANAR_INSTRUMENT"]
+
+        if self.options.lto:
+            self.cpp_info.cxxflags = ["-flto"]
+            self.cpp_info.exelinkflags = ["-flto"]
+            self.cpp_info.sharedlinkflags = ["-flto"]
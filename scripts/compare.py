@@ -0,0 +1,56 @@
+import argparse
+import json
+import shutil
+import sys
+from pathlib import Path
+
+
+def load(path: Path) -> dict[str, float]:
+    with path.open() as file:
+        report = json.load(file)
+
+    return {
+        i["name"]: i["real_time"]
+        for i in report["benchmarks"]
+        if i.get("run_type", "iteration") == "iteration"
+    }
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Flag benchmark regressions against a baseline")
+    parser.add_argument("current", type=Path, nargs="?", default=Path("dist/benchmarks.json"))
+    parser.add_argument("baseline", type=Path, nargs="?", default=Path("benchmarks/baseline.json"))
+    parser.add_argument("--threshold", type=float, default=0.1)
+    parser.add_argument("--update", action="store_true")
+    args = parser.parse_args()
+
+    if args.update:
+        args.baseline.parent.mkdir(parents=True, exist_ok=True)
+        shutil.copyfile(args.current, args.baseline)
+        print(f"Stored {args.current} as {args.baseline}")
+        return 0
+
+    if not args.baseline.exists():
+        print(f"No baseline at {args.baseline}, store one with --update", file=sys.stderr)
+        return 1
+
+    current = load(args.current)
+    baseline = load(args.baseline)
+    regressions = 0
+
+    for name, time in current.items():
+        if name not in baseline:
+            continue
+
+        change = time / baseline[name] - 1
+        flag = change > args.threshold
+        regressions += flag
+
+        print(f"{'!' if flag else ' '} {name:<48} {baseline[name]:>14.0f} {time:>14.0f} {change:>+8.1%}")
+
+    print(f"{regressions} regression(s) beyond {args.threshold:.0%}")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
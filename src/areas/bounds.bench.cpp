@@ -0,0 +1,133 @@
+#include "bounds.hpp"
+#include "../linear/matrix.tpp"
+#include "../points/point.tpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace planar;
+
+namespace {
+    std::vector<Bounds> scatter(size_t count) {
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<double> position(0, 100);
+        std::uniform_real_distribution<double> extent(0, 4);
+
+        std::vector<Bounds> bounds;
+
+        for (size_t i = 0; i < count; ++i) {
+            bounds.emplace_back(position(generator), position(generator), extent(generator), extent(generator));
+        }
+
+        return bounds;
+    }
+}
+
+void BoundsContains(benchmark::State &state) {
+    auto bounds = scatter(static_cast<size_t>(state.range(0)));
+    Point<double> probe(50, 50);
+
+    for (auto _ : state) {
+        size_t count = 0;
+
+        for (const auto &item : bounds) {
+            count += item.contains(probe) ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BoundsOverlaps(benchmark::State &state) {
+    auto bounds = scatter(static_cast<size_t>(state.range(0)));
+    Bounds viewport(25, 25, 50, 50);
+
+    for (auto _ : state) {
+        size_t count = 0;
+
+        for (const auto &item : bounds) {
+            count += item.overlaps(viewport) ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BoundsTransform(benchmark::State &state) {
+    auto bounds = scatter(static_cast<size_t>(state.range(0)));
+    Point<double> origin(50, 50);
+
+    for (auto _ : state) {
+        for (auto &item : bounds) {
+            item = item.shift({1, -1}).scale_about(1.01, origin).pad({0.01, 0.01});
+        }
+
+        benchmark::DoNotOptimize(bounds.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BoundsCenter(benchmark::State &state) {
+    auto bounds = scatter(static_cast<size_t>(state.range(0)));
+    Size<double> region(1, 1);
+
+    for (auto _ : state) {
+        for (auto &item : bounds) {
+            benchmark::DoNotOptimize(item.center(region).center());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BoundsTile(benchmark::State &state) {
+    auto side = static_cast<size_t>(state.range(0));
+    Bounds cell(0, 0, 4, 3);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cell.tile({side, side}, {1, 1}).data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void BoundsEnclosePoints(benchmark::State &state) {
+    std::vector<Point<double>> points;
+    points.reserve(static_cast<size_t>(state.range(0)));
+
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        auto k = static_cast<double>(i);
+        points.emplace_back(k * 0.5, 100 - k);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Bounds::enclose(points));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BoundsEnclose(benchmark::State &state) {
+    auto bounds = scatter(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Bounds(bounds));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BoundsContains)->Range(1 << 10, 1 << 16);
+BENCHMARK(BoundsOverlaps)->Range(1 << 10, 1 << 16);
+BENCHMARK(BoundsTransform)->Range(1 << 10, 1 << 16);
+BENCHMARK(BoundsCenter)->Range(1 << 10, 1 << 16);
+BENCHMARK(BoundsTile)->RangeMultiplier(4)->Range(1 << 3, 1 << 11);
+BENCHMARK(BoundsEnclosePoints)->RangeMultiplier(10)->Range(1, 10000000);
+BENCHMARK(BoundsEnclose)->Range(1 << 10, 1 << 16);
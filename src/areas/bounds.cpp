@@ -1,53 +1,63 @@
-#include "bounds.hpp"
+#include "bounds.tpp"
 #include "../areas/size.tpp"
 #include "../linear/matrix.tpp"
 #include "../points/point.tpp"
 #include "../points/segment.tpp"
+#include "../scalar/chunks.tpp"
 #include "../scalar/dimensions.hpp"
+#include "../scalar/instrument.hpp"
+#include "../scalar/length.hpp"
+#include "enclosure.hpp"
+#include "grid.hpp"
+#include "sweep.hpp"
+#include "views.hpp"
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <fmt/core.h>
-#include <functional>
-#include <funky/concrete/booleans.tpp>
-#include <funky/generics/iterables.tpp>
-#include <funky/generics/pairs.tpp>
-#include <funky/generics/sets.tpp>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
-planar::Bounds::Bounds() : point(0, 0), size(0, 0) {
-}
-
-planar::Bounds::Bounds(double x, double y, double w, double h) : point(Point(x, y)), size(Size(w, h)) {
-}
-
-planar::Bounds::Bounds(const Point<int> &point, const Size<int> &size)
-    : point(Point<double>(point.x(), point.y()))
-    , size(Size<double>(size.width(), size.height())) {
-}
+namespace {
+    template <typename V, typename A = std::allocator<std::ranges::range_value_t<V>>>
+    std::vector<std::ranges::range_value_t<V>, A> collect(const V &view, const A &allocator = A()) {
+        std::vector<std::ranges::range_value_t<V>, A> output(allocator);
+        output.reserve(std::ranges::size(view));
+        std::ranges::copy(view, std::back_inserter(output));
+        return output;
+    }
 
-planar::Bounds::Bounds(const Point<double> &point, const Size<double> &size) : point(point), size(size) {
+    template <typename V>
+    void fill(const V &view, std::span<std::ranges::range_value_t<V>> output) {
+        planar::require(output.size(), std::ranges::size(view));
+        std::ranges::copy(view, output.begin());
+    }
 }
 
 planar::Bounds::Bounds(const std::vector<Bounds> &bounds) {
-    using F = std::function<Point<double>(const Bounds &)>;
+    Enclosure enclosure;
 
-    F left = [](const auto &x) {
-        return x.point;
-    };
-    F right = [](const auto &x) {
-        return x.point + x.size;
-    };
+    for (const auto &item : bounds) {
+        enclosure.add(item.point);
+        enclosure.add(item.point + item.size);
+    }
 
-    auto interval = enclose(funky::concat(
-        funky::map<std::vector<Point<double>>>(left, bounds),
-        funky::map<std::vector<Point<double>>>(right, bounds)
-    ));
+    auto interval = enclosure.bounds();
 
     point = interval.point;
     size  = interval.size;
 }
 
-planar::Bounds::Bounds(const Matrix<Bounds> &bounds) {
+planar::Bounds::Bounds(const Matrix<Bounds> &bounds) : Bounds(bounds.view()) {
+}
+
+planar::Bounds::Bounds(const MatrixView<const Bounds> &bounds) {
     auto limits = bounds.size();
 
     auto first = bounds.get({0, 0});
@@ -57,76 +67,82 @@ planar::Bounds::Bounds(const Matrix<Bounds> &bounds) {
     size  = last.point.projection() - first.point.projection() + last.size;
 }
 
-planar::Bounds planar::Bounds::enclose(const std::vector<Point<double>> &points) {
-    auto x = funky::map<std::vector<double>>(
-        [](const auto &p) {
-            return p.x();
-        },
-        points
-    );
+planar::Bounds planar::Bounds::enclose(std::span<const Point<double>> points, size_t threads) {
+    PLANAR_MEASURE("Bounds::enclose");
+    PLANAR_COUNT(points.size());
 
-    auto y = funky::map<std::vector<double>>(
-        [](const auto &p) {
-            return p.y();
-        },
-        points
-    );
+    Chunks chunks(points.size(), threshold, threads);
+    Enclosure enclosure;
 
-    Point<double> point(funky::min(x, 0), funky::min(y, 0));
-    Size<double> size(funky::max(x, 0) - point.x(), funky::max(y, 0) - point.y());
+    if (chunks.count <= 1) {
+        enclosure.add(points);
+        return enclosure.bounds();
+    }
 
-    return {point, size};
-}
+    std::array<Enclosure, Chunks::limit> partial;
 
-bool planar::Bounds::operator==(const Bounds &rhs) const {
-    return point == rhs.point && size == rhs.size;
-}
+    chunks.run([&points, &partial](size_t index, const planar::Slice &range) {
+        partial[index].add(points.subspan(range.start, range.end - range.start));
+    });
 
-bool planar::Bounds::operator!=(const Bounds &rhs) const {
-    return !(*this == rhs);
-}
+    for (size_t i = 0; i < chunks.count; ++i) {
+        enclosure.merge(partial[i]);
+    }
 
-bool planar::Bounds::operator<(const Bounds &rhs) const {
-    return point < rhs.point || (point == rhs.point && size < rhs.size);
+    return enclosure.bounds();
 }
 
-bool planar::Bounds::operator>(const Bounds &rhs) const {
-    return rhs < *this;
-}
+planar::Bounds planar::Bounds::enclose(std::span<const double> x, std::span<const double> y, size_t threads) {
+    PLANAR_MEASURE("Bounds::enclose");
 
-bool planar::Bounds::operator<=(const Bounds &rhs) const {
-    return !(rhs < *this);
-}
+    auto size = std::min(x.size(), y.size());
+    PLANAR_COUNT(size);
 
-bool planar::Bounds::operator>=(const Bounds &rhs) const {
-    return !(*this < rhs);
-}
+    Chunks chunks(size, threshold, threads);
+    Enclosure enclosure;
+
+    if (chunks.count <= 1) {
+        enclosure.add(x, y);
+        return enclosure.bounds();
+    }
+
+    std::array<Enclosure, Chunks::limit> partial;
+
+    chunks.run([&x, &y, &partial](size_t index, const planar::Slice &range) {
+        auto length = range.end - range.start;
+        partial[index].add(x.subspan(range.start, length), y.subspan(range.start, length));
+    });
 
-planar::Bounds planar::Bounds::operator+(const planar::Size<double> &rhs) const {
-    return {point, size + rhs};
+    for (size_t i = 0; i < chunks.count; ++i) {
+        enclosure.merge(partial[i]);
+    }
+
+    return enclosure.bounds();
 }
 
-planar::Bounds planar::Bounds::operator-(const planar::Size<double> &rhs) const {
-    return {point, size - rhs};
+std::vector<std::pair<size_t, size_t>> planar::Bounds::overlapping_pairs(const std::vector<Bounds> &bounds) {
+    return Sweep(bounds).pairs();
 }
 
-planar::Bounds planar::Bounds::operator*(const double &rhs) const {
-    return {point, size * rhs};
+std::pmr::vector<std::pair<size_t, size_t>> planar::Bounds::overlapping_pairs(
+    const std::vector<Bounds> &bounds,
+    std::pmr::memory_resource *resource
+) {
+    return Sweep(bounds).pairs(0, resource);
 }
 
-planar::Bounds planar::Bounds::operator/(const double &rhs) const {
-    return {point, size / rhs};
+void planar::Bounds::overlapping_pairs(
+    const std::vector<Bounds> &bounds,
+    std::vector<std::pair<size_t, size_t>> &output
+) {
+    Sweep(bounds).pairs(0, output);
 }
 
 std::string planar::Bounds::repr() const {
     return fmt::format("{{{}, {}}}", point.repr(), size.repr());
 }
 
-bool planar::Bounds::empty() const {
-    return size.empty();
-}
-
-std::vector<planar::Point<double>> planar::Bounds::corners() const {
+std::array<planar::Point<double>, 4> planar::Bounds::corners() const {
     return {
         point,
         point + Size<double>(size.width(), 0),
@@ -135,7 +151,7 @@ std::vector<planar::Point<double>> planar::Bounds::corners() const {
     };
 }
 
-std::vector<planar::Point<double>> planar::Bounds::midpoints() const {
+std::array<planar::Point<double>, 4> planar::Bounds::midpoints() const {
     return {
         point + Size<double>(size.width() / 2, 0),
         point + Size<double>(0, size.height() / 2),
@@ -144,187 +160,117 @@ std::vector<planar::Point<double>> planar::Bounds::midpoints() const {
     };
 }
 
-std::vector<planar::Segment<double>> planar::Bounds::segments() const {
+std::array<planar::Segment<double>, 4> planar::Bounds::segments() const {
     auto points = corners();
-    return {
+    return {{
         {points[0], points[1]},
         {points[0], points[2]},
         {points[1], points[3]},
         {points[2], points[3]},
-    };
+    }};
 }
 
-bool planar::Bounds::contains(const Point<double> &rhs) const {
-    auto upper = point + size;
-    return funky::all(std::vector<bool>({
-        point.x() <= rhs.x(),
-        point.y() <= rhs.y(),
-        rhs.x() <= upper.x(),
-        rhs.y() <= upper.y(),
-    }));
+planar::Bounds planar::Bounds::slice(const Dimensions &dimensions, const planar::Slice &rows, const planar::Slice &cols)
+    const {
+    return Grid(*this, dimensions).slice(rows, cols);
 }
 
-bool planar::Bounds::overlaps(const Bounds &bounds) const {
-    std::function<bool(const Point<double> &x)> contains_corner = [&bounds](const auto &x) {
-        return bounds.contains(x);
-    };
-
-    return funky::any(contains_corner, corners());
+std::vector<planar::Bounds> planar::Bounds::slice(
+    const Dimensions &dimensions,
+    std::span<const std::pair<planar::Slice, planar::Slice>> spans
+) const {
+    std::vector<Bounds> output(spans.size());
+    Grid(*this, dimensions).slice(spans, output);
+    return output;
 }
 
-planar::Point<double> planar::Bounds::center() const {
-    return point + size / 2;
+std::pmr::vector<planar::Bounds> planar::Bounds::slice(
+    const Dimensions &dimensions,
+    std::span<const std::pair<planar::Slice, planar::Slice>> spans,
+    std::pmr::memory_resource *resource
+) const {
+    std::pmr::vector<Bounds> output(spans.size(), resource);
+    Grid(*this, dimensions).slice(spans, output);
+    return output;
 }
 
-planar::Bounds planar::Bounds::center(const Size<double> &region) const {
-    return align(region, Alignment::Center);
+void planar::Bounds::slice(
+    const Dimensions &dimensions,
+    std::span<const std::pair<planar::Slice, planar::Slice>> spans,
+    std::span<Bounds> output
+) const {
+    Grid(*this, dimensions).slice(spans, output);
 }
 
-planar::Bounds planar::Bounds::rebase() const {
-    return {0, 0, size.width(), size.height()};
+std::vector<planar::Point<double>> planar::Bounds::sample(size_t side) const {
+    return collect(sample_view(side));
 }
 
-planar::Bounds planar::Bounds::shift(const Size<double> &move) const {
-    return {point + move, size};
+std::pmr::vector<planar::Point<double>> planar::Bounds::sample(size_t side, std::pmr::memory_resource *resource)
+    const {
+    return collect(sample_view(side), std::pmr::polymorphic_allocator<Point<double>>(resource));
 }
 
-planar::Bounds planar::Bounds::pad(const Size<double> &border) const {
-    return {point + border / 2, size - border};
+void planar::Bounds::sample(size_t side, std::span<Point<double>> output) const {
+    fill(sample_view(side), output);
 }
 
-planar::Bounds planar::Bounds::constrain(const Size<double> &limits) const {
-    auto w = limits.width();
-    auto h = limits.height();
-
-    auto W = size.width();
-    auto H = size.height();
-
-    if (w <= W && h <= H) {
-        return center(limits);
-    }
-
-    Size<double> narrow(H * w / h, H);
-    Size<double> wide(W, W * h / w);
-
-    return center((H * w / h) < w && H < h ? narrow : wide);
+planar::SampleView planar::Bounds::sample_view(size_t side) const {
+    return {*this, side};
 }
 
-planar::Bounds planar::Bounds::align(const Size<double> &region, Alignment alignment) const {
-    auto steps = 0;
-
-    auto w = region.width();
-    auto h = region.height();
-
-    if (alignment == Alignment::Center) {
-        steps = 1;
-    }
-
-    if (alignment == Alignment::Right) {
-        steps = 2;
-    }
-
-    return {point.x() + steps * (size.width() - w) / 2, point.y() + (size.height() - h) / 2, w, h};
+std::vector<planar::Bounds> planar::Bounds::rows(size_t n) const {
+    return collect(rows_view(n));
 }
 
-planar::Bounds planar::Bounds::scale(const double &factor) const {
-    return scale({factor, factor});
+std::vector<planar::Bounds> planar::Bounds::cols(size_t n) const {
+    return collect(cols_view(n));
 }
 
-planar::Bounds planar::Bounds::scale(const Size<double> &factor) const {
-    return scale_about(factor, center());
+std::pmr::vector<planar::Bounds> planar::Bounds::rows(size_t n, std::pmr::memory_resource *resource) const {
+    return collect(rows_view(n), std::pmr::polymorphic_allocator<Bounds>(resource));
 }
 
-planar::Bounds planar::Bounds::scale_about(const double &factor, const Point<double> &origin) const {
-    return scale_about({factor, factor}, origin);
+std::pmr::vector<planar::Bounds> planar::Bounds::cols(size_t n, std::pmr::memory_resource *resource) const {
+    return collect(cols_view(n), std::pmr::polymorphic_allocator<Bounds>(resource));
 }
 
-planar::Bounds planar::Bounds::scale_about(const Size<double> &factor, const Point<double> &origin) const {
-    auto x = factor.width() * point.x() + (1 - factor.width()) * origin.x();
-    auto y = factor.height() * point.y() + (1 - factor.height()) * origin.y();
-    return {
-        {x, y},
-        size.scale(factor)
-    };
+void planar::Bounds::rows(size_t n, std::span<Bounds> output) const {
+    fill(rows_view(n), output);
 }
 
-planar::Bounds planar::Bounds::slice(const Dimensions &dimensions, const planar::Slice &rows, const planar::Slice &cols)
-    const {
-    return Bounds(grid(dimensions).slice(rows, cols));
+void planar::Bounds::cols(size_t n, std::span<Bounds> output) const {
+    fill(cols_view(n), output);
 }
 
-std::pair<planar::Bounds, planar::Bounds> planar::Bounds::split_width(double x) const {
-    return {
-        Bounds(point, Size<double>(x, size.height())),
-        Bounds(point + Size<double>(x, 0), size - Size<double>(x, 0)),
-    };
+planar::DivisionView planar::Bounds::rows_view(size_t n) const {
+    Size<double> segment(size.width(), size.height() / static_cast<double>(n));
+    return {{point, segment, {0, segment.height()}}, n};
 }
 
-std::pair<planar::Bounds, planar::Bounds> planar::Bounds::split_height(double y) const {
-    return {
-        Bounds(point, Size<double>(size.width(), y)),
-        Bounds(point + Size<double>(0, y), size - Size<double>(0, y)),
-    };
+planar::DivisionView planar::Bounds::cols_view(size_t n) const {
+    Size<double> segment(size.width() / static_cast<double>(n), size.height());
+    return {{point, segment, {segment.width(), 0}}, n};
 }
 
-std::vector<planar::Point<double>> planar::Bounds::sample(size_t side) const {
-    if (side == 1) {
-        return {center()};
-    }
-
-    auto pairs = funky::product(
-        funky::linspace(point.x(), point.x() + size.width(), side),
-        funky::linspace(point.y(), point.y() + size.height(), side)
-    );
-
-    return funky::map<std::vector<Point<double>>>(
-        [](auto pair) {
-            return Point<double>(pair.first, pair.second);
-        },
-        pairs
-    );
+planar::Matrix<planar::Bounds> planar::Bounds::tile(const Dimensions &dimensions, const Size<double> &padding) const {
+    return Grid(point, size, size + padding, dimensions).matrix();
 }
 
-std::vector<planar::Bounds> planar::Bounds::rows(size_t n) const {
-    planar::Size<double> segment(size.width(), size.height() / static_cast<double>(n));
-
-    std::function<planar::Bounds(size_t)> split = [&segment, &point = point](auto i) {
-        planar::Point<double> row(point.x(), point.y() + segment.height() * static_cast<double>(i));
-        return planar::Bounds(row, segment);
-    };
-
-    return funky::map<std::vector<Bounds>>(split, funky::range(n));
+std::pmr::vector<planar::Bounds> planar::Bounds::tile(
+    const Dimensions &dimensions,
+    const Size<double> &padding,
+    std::pmr::memory_resource *resource
+) const {
+    return collect(tile_view(dimensions, padding), std::pmr::polymorphic_allocator<Bounds>(resource));
 }
 
-std::vector<planar::Bounds> planar::Bounds::cols(size_t n) const {
-    planar::Size<double> segment(size.width() / static_cast<double>(n), size.height());
-
-    std::function<planar::Bounds(size_t)> split = [&segment, &point = point](auto i) {
-        planar::Point<double> row(point.x() + segment.width() * i, point.y());
-        return planar::Bounds(row, segment);
-    };
-
-    return funky::map<std::vector<Bounds>>(split, funky::range(n));
+void planar::Bounds::tile(const Dimensions &dimensions, const Size<double> &padding, std::span<Bounds> output) const {
+    fill(tile_view(dimensions, padding), output);
 }
 
-planar::Matrix<planar::Bounds> planar::Bounds::tile(const Dimensions &dimensions, const Size<double> &padding) const {
-    auto pairs = funky::product(funky::range(dimensions.rows), funky::range(dimensions.cols));
-
-    return {
-        funky::map<std::vector<Bounds>>(
-            [&point = point, &size = size, &padding](auto pair) {
-                auto x = static_cast<double>(pair.first);
-                auto y = static_cast<double>(pair.second);
-
-                Point<double> offset(
-                    point.x() + (size + padding).width() * y,
-                    point.y() + (size + padding).height() * x
-                );
-                Bounds bounds(offset, size);
-                return bounds;
-            },
-            pairs
-        ),
-        dimensions.cols};
+planar::CellView planar::Bounds::tile_view(const Dimensions &dimensions, const Size<double> &padding) const {
+    return CellView(Grid(point, size, size + padding, dimensions));
 }
 
 planar::Matrix<planar::Bounds> planar::Bounds::grid(
@@ -332,13 +278,31 @@ planar::Matrix<planar::Bounds> planar::Bounds::grid(
     const Size<double> &padding,
     const Size<double> &margin
 ) const {
-    auto rows = static_cast<double>(dimensions.rows);
-    auto cols = static_cast<double>(dimensions.cols);
+    return Grid(*this, dimensions, padding, margin).matrix();
+}
+
+std::pmr::vector<planar::Bounds> planar::Bounds::grid(
+    const Dimensions &dimensions,
+    const Size<double> &padding,
+    const Size<double> &margin,
+    std::pmr::memory_resource *resource
+) const {
+    return collect(grid_view(dimensions, padding, margin), std::pmr::polymorphic_allocator<Bounds>(resource));
+}
 
-    Size<double> section(
-        (size.width() - 2 * margin.width()) / cols - 2 * padding.width(),
-        (size.height() - 2 * margin.height()) / rows - 2 * padding.height()
-    );
+void planar::Bounds::grid(
+    const Dimensions &dimensions,
+    const Size<double> &padding,
+    const Size<double> &margin,
+    std::span<Bounds> output
+) const {
+    fill(grid_view(dimensions, padding, margin), output);
+}
 
-    return Bounds(point + padding + margin, section).tile(dimensions, padding * 2);
+planar::CellView planar::Bounds::grid_view(
+    const Dimensions &dimensions,
+    const Size<double> &padding,
+    const Size<double> &margin
+) const {
+    return CellView(Grid(*this, dimensions, padding, margin));
 }
@@ -3,7 +3,11 @@
 
 #include "../points/point.hpp"
 #include "size.tpp"
+#include <array>
 #include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,9 +22,16 @@ namespace planar {
     class Dimensions;
     class Slice;
 
+    class SampleView;
+    class DivisionView;
+    class CellView;
+
     template <typename T>
     class Matrix;
 
+    template <typename T>
+    class MatrixView;
+
     template <typename T>
     class Segment;
 
@@ -29,77 +40,338 @@ namespace planar {
         Point<double> point;
         Size<double> size;
 
-        static Bounds enclose(const std::vector<Point<double>> &points);
+        static constexpr size_t threshold = 1 << 18;
+
+        static Bounds enclose(std::span<const Point<double>> points, size_t threads = 0);
+        static Bounds enclose(std::span<const double> x, std::span<const double> y, size_t threads = 0);
 
-        Bounds();
-        Bounds(double x, double y, double w, double h);
+        static std::vector<std::pair<size_t, size_t>> overlapping_pairs(const std::vector<Bounds> &bounds);
 
-        Bounds(const Point<int> &point, const Size<int> &size);
-        Bounds(const Point<double> &point, const Size<double> &size);
+        static std::pmr::vector<std::pair<size_t, size_t>> overlapping_pairs(
+            const std::vector<Bounds> &bounds,
+            std::pmr::memory_resource *resource
+        );
+
+        static void overlapping_pairs(
+            const std::vector<Bounds> &bounds,
+            std::vector<std::pair<size_t, size_t>> &output
+        );
+
+        constexpr Bounds() noexcept;
+        constexpr Bounds(double x, double y, double w, double h) noexcept;
+
+        constexpr Bounds(const Point<int> &point, const Size<int> &size) noexcept;
+        constexpr Bounds(const Point<double> &point, const Size<double> &size) noexcept;
 
         explicit Bounds(const std::vector<Bounds> &bounds);
         explicit Bounds(const Matrix<Bounds> &bounds);
+        explicit Bounds(const MatrixView<const Bounds> &bounds);
 
-        bool operator==(const Bounds &rhs) const;
-        bool operator!=(const Bounds &rhs) const;
-        bool operator<(const Bounds &rhs) const;
-        bool operator>(const Bounds &rhs) const;
-        bool operator<=(const Bounds &rhs) const;
-        bool operator>=(const Bounds &rhs) const;
+        constexpr bool operator==(const Bounds &rhs) const noexcept;
+        constexpr bool operator!=(const Bounds &rhs) const noexcept;
+        constexpr bool operator<(const Bounds &rhs) const noexcept;
+        constexpr bool operator>(const Bounds &rhs) const noexcept;
+        constexpr bool operator<=(const Bounds &rhs) const noexcept;
+        constexpr bool operator>=(const Bounds &rhs) const noexcept;
 
-        Bounds operator*(const double &rhs) const;
-        Bounds operator/(const double &rhs) const;
+        constexpr Bounds operator*(const double &rhs) const noexcept;
+        constexpr Bounds operator/(const double &rhs) const noexcept;
 
-        Bounds operator+(const Size<double> &rhs) const;
-        Bounds operator-(const Size<double> &rhs) const;
+        constexpr Bounds operator+(const Size<double> &rhs) const noexcept;
+        constexpr Bounds operator-(const Size<double> &rhs) const noexcept;
 
         std::string repr() const;
 
-        bool empty() const;
+        constexpr bool empty() const noexcept;
 
-        std::vector<Point<double>> corners() const;
-        std::vector<Point<double>> midpoints() const;
+        std::array<Point<double>, 4> corners() const;
+        std::array<Point<double>, 4> midpoints() const;
 
-        std::vector<Segment<double>> segments() const;
+        std::array<Segment<double>, 4> segments() const;
 
-        bool contains(const Point<double> &rhs) const;
-        bool overlaps(const Bounds &bounds) const;
+        constexpr bool contains(const Point<double> &rhs) const noexcept;
+        constexpr bool overlaps(const Bounds &bounds) const noexcept;
 
-        Point<double> center() const;
-        Bounds center(const Size<double> &region) const;
+        constexpr Point<double> center() const noexcept;
+        constexpr Bounds center(const Size<double> &region) const noexcept;
 
-        Bounds rebase() const;
+        constexpr Bounds rebase() const noexcept;
 
-        Bounds shift(const Size<double> &move) const;
+        constexpr Bounds shift(const Size<double> &move) const noexcept;
 
-        Bounds pad(const Size<double> &border) const;
+        constexpr Bounds pad(const Size<double> &border) const noexcept;
 
-        Bounds constrain(const Size<double> &limits) const;
-        Bounds align(const Size<double> &region, Alignment alignment) const;
+        constexpr Bounds constrain(const Size<double> &limits) const noexcept;
+        constexpr Bounds align(const Size<double> &region, Alignment alignment) const noexcept;
 
-        Bounds scale(const double &factor) const;
-        Bounds scale(const Size<double> &factor) const;
+        constexpr Bounds scale(const double &factor) const noexcept;
+        constexpr Bounds scale(const Size<double> &factor) const noexcept;
 
-        Bounds scale_about(const double &factor, const Point<double> &origin) const;
-        Bounds scale_about(const Size<double> &factor, const Point<double> &origin) const;
+        constexpr Bounds scale_about(const double &factor, const Point<double> &origin) const noexcept;
+        constexpr Bounds scale_about(const Size<double> &factor, const Point<double> &origin) const noexcept;
 
         Bounds slice(const Dimensions &dimensions, const planar::Slice &rows, const planar::Slice &cols) const;
 
-        std::pair<Bounds, Bounds> split_width(double x) const;
-        std::pair<Bounds, Bounds> split_height(double y) const;
+        std::vector<Bounds> slice(
+            const Dimensions &dimensions,
+            std::span<const std::pair<planar::Slice, planar::Slice>> spans
+        ) const;
+
+        std::pmr::vector<Bounds> slice(
+            const Dimensions &dimensions,
+            std::span<const std::pair<planar::Slice, planar::Slice>> spans,
+            std::pmr::memory_resource *resource
+        ) const;
+
+        void slice(
+            const Dimensions &dimensions,
+            std::span<const std::pair<planar::Slice, planar::Slice>> spans,
+            std::span<Bounds> output
+        ) const;
+
+        constexpr std::pair<Bounds, Bounds> split_width(double x) const noexcept;
+        constexpr std::pair<Bounds, Bounds> split_height(double y) const noexcept;
 
         std::vector<Point<double>> sample(size_t side) const;
+        std::pmr::vector<Point<double>> sample(size_t side, std::pmr::memory_resource *resource) const;
+        void sample(size_t side, std::span<Point<double>> output) const;
+
+        template <std::output_iterator<Point<double>> Iterator>
+        Iterator sample(size_t side, Iterator output) const;
+
+        SampleView sample_view(size_t side) const;
 
         std::vector<Bounds> rows(size_t n) const;
         std::vector<Bounds> cols(size_t n) const;
 
+        std::pmr::vector<Bounds> rows(size_t n, std::pmr::memory_resource *resource) const;
+        std::pmr::vector<Bounds> cols(size_t n, std::pmr::memory_resource *resource) const;
+
+        void rows(size_t n, std::span<Bounds> output) const;
+        void cols(size_t n, std::span<Bounds> output) const;
+
+        template <std::output_iterator<Bounds> Iterator>
+        Iterator rows(size_t n, Iterator output) const;
+
+        template <std::output_iterator<Bounds> Iterator>
+        Iterator cols(size_t n, Iterator output) const;
+
+        DivisionView rows_view(size_t n) const;
+        DivisionView cols_view(size_t n) const;
+
         Matrix<Bounds> tile(const Dimensions &dimensions, const Size<double> &padding = {0.0, 0.0}) const;
 
+        std::pmr::vector<Bounds> tile(
+            const Dimensions &dimensions,
+            const Size<double> &padding,
+            std::pmr::memory_resource *resource
+        ) const;
+
+        void tile(const Dimensions &dimensions, const Size<double> &padding, std::span<Bounds> output) const;
+
+        template <std::output_iterator<Bounds> Iterator>
+        Iterator tile(const Dimensions &dimensions, const Size<double> &padding, Iterator output) const;
+
+        CellView tile_view(const Dimensions &dimensions, const Size<double> &padding = {0.0, 0.0}) const;
+
         Matrix<Bounds> grid(
             const Dimensions &dimensions,
             const Size<double> &padding = {0.0, 0.0},
             const Size<double> &margin  = {0.0, 0.0}
         ) const;
+
+        std::pmr::vector<Bounds> grid(
+            const Dimensions &dimensions,
+            const Size<double> &padding,
+            const Size<double> &margin,
+            std::pmr::memory_resource *resource
+        ) const;
+
+        void grid(
+            const Dimensions &dimensions,
+            const Size<double> &padding,
+            const Size<double> &margin,
+            std::span<Bounds> output
+        ) const;
+
+        template <std::output_iterator<Bounds> Iterator>
+        Iterator grid(
+            const Dimensions &dimensions,
+            const Size<double> &padding,
+            const Size<double> &margin,
+            Iterator output
+        ) const;
+
+        CellView grid_view(
+            const Dimensions &dimensions,
+            const Size<double> &padding = {0.0, 0.0},
+            const Size<double> &margin  = {0.0, 0.0}
+        ) const;
+    };
+}
+
+constexpr planar::Bounds::Bounds() noexcept : point(0, 0), size(0, 0) {
+}
+
+constexpr planar::Bounds::Bounds(double x, double y, double w, double h) noexcept
+    : point(x, y)
+    , size(w, h) {
+}
+
+constexpr planar::Bounds::Bounds(const Point<int> &point, const Size<int> &size) noexcept
+    : point(Point<double>(point.x(), point.y()))
+    , size(Size<double>(size.width(), size.height())) {
+}
+
+constexpr planar::Bounds::Bounds(const Point<double> &point, const Size<double> &size) noexcept
+    : point(point)
+    , size(size) {
+}
+
+constexpr bool planar::Bounds::operator==(const Bounds &rhs) const noexcept {
+    return point == rhs.point && size == rhs.size;
+}
+
+constexpr bool planar::Bounds::operator!=(const Bounds &rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr bool planar::Bounds::operator<(const Bounds &rhs) const noexcept {
+    return point < rhs.point || (point == rhs.point && size < rhs.size);
+}
+
+constexpr bool planar::Bounds::operator>(const Bounds &rhs) const noexcept {
+    return rhs < *this;
+}
+
+constexpr bool planar::Bounds::operator<=(const Bounds &rhs) const noexcept {
+    return !(rhs < *this);
+}
+
+constexpr bool planar::Bounds::operator>=(const Bounds &rhs) const noexcept {
+    return !(*this < rhs);
+}
+
+constexpr planar::Bounds planar::Bounds::operator+(const planar::Size<double> &rhs) const noexcept {
+    return {point, size + rhs};
+}
+
+constexpr planar::Bounds planar::Bounds::operator-(const planar::Size<double> &rhs) const noexcept {
+    return {point, size - rhs};
+}
+
+constexpr planar::Bounds planar::Bounds::operator*(const double &rhs) const noexcept {
+    return {point, size * rhs};
+}
+
+constexpr planar::Bounds planar::Bounds::operator/(const double &rhs) const noexcept {
+    return {point, size / rhs};
+}
+
+constexpr bool planar::Bounds::empty() const noexcept {
+    return size.empty();
+}
+
+constexpr bool planar::Bounds::contains(const Point<double> &rhs) const noexcept {
+    auto upper = point + size;
+    return point.x() <= rhs.x() && point.y() <= rhs.y() && rhs.x() <= upper.x() && rhs.y() <= upper.y();
+}
+
+constexpr bool planar::Bounds::overlaps(const Bounds &bounds) const noexcept {
+    auto upper = point + size;
+    auto other = bounds.point + bounds.size;
+
+    return point.x() <= other.x() && bounds.point.x() <= upper.x() && point.y() <= other.y() &&
+           bounds.point.y() <= upper.y();
+}
+
+constexpr planar::Point<double> planar::Bounds::center() const noexcept {
+    return point + size / 2;
+}
+
+constexpr planar::Bounds planar::Bounds::center(const Size<double> &region) const noexcept {
+    return align(region, Alignment::Center);
+}
+
+constexpr planar::Bounds planar::Bounds::rebase() const noexcept {
+    return {0, 0, size.width(), size.height()};
+}
+
+constexpr planar::Bounds planar::Bounds::shift(const Size<double> &move) const noexcept {
+    return {point + move, size};
+}
+
+constexpr planar::Bounds planar::Bounds::pad(const Size<double> &border) const noexcept {
+    return {point + border / 2, size - border};
+}
+
+constexpr planar::Bounds planar::Bounds::constrain(const Size<double> &limits) const noexcept {
+    auto w = limits.width();
+    auto h = limits.height();
+
+    auto W = size.width();
+    auto H = size.height();
+
+    if (w <= W && h <= H) {
+        return center(limits);
+    }
+
+    Size<double> narrow(H * w / h, H);
+    Size<double> wide(W, W * h / w);
+
+    return center((H * w / h) < w && H < h ? narrow : wide);
+}
+
+constexpr planar::Bounds planar::Bounds::align(const Size<double> &region, Alignment alignment) const noexcept {
+    auto steps = 0;
+
+    auto w = region.width();
+    auto h = region.height();
+
+    if (alignment == Alignment::Center) {
+        steps = 1;
+    }
+
+    if (alignment == Alignment::Right) {
+        steps = 2;
+    }
+
+    return {point.x() + steps * (size.width() - w) / 2, point.y() + (size.height() - h) / 2, w, h};
+}
+
+constexpr planar::Bounds planar::Bounds::scale(const double &factor) const noexcept {
+    return scale({factor, factor});
+}
+
+constexpr planar::Bounds planar::Bounds::scale(const Size<double> &factor) const noexcept {
+    return scale_about(factor, center());
+}
+
+constexpr planar::Bounds planar::Bounds::scale_about(const double &factor, const Point<double> &origin) const noexcept {
+    return scale_about({factor, factor}, origin);
+}
+
+constexpr planar::Bounds planar::Bounds::scale_about(const Size<double> &factor, const Point<double> &origin)
+    const noexcept {
+    auto x = factor.width() * point.x() + (1 - factor.width()) * origin.x();
+    auto y = factor.height() * point.y() + (1 - factor.height()) * origin.y();
+    return {
+        {x, y},
+        size.scale(factor)
+    };
+}
+
+constexpr std::pair<planar::Bounds, planar::Bounds> planar::Bounds::split_width(double x) const noexcept {
+    return {
+        Bounds(point, Size<double>(x, size.height())),
+        Bounds(point + Size<double>(x, 0), size - Size<double>(x, 0)),
+    };
+}
+
+constexpr std::pair<planar::Bounds, planar::Bounds> planar::Bounds::split_height(double y) const noexcept {
+    return {
+        Bounds(point, Size<double>(size.width(), y)),
+        Bounds(point + Size<double>(0, y), size - Size<double>(0, y)),
     };
 }
 
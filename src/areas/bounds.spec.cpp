@@ -1,9 +1,17 @@
-#include "../areas/bounds.hpp"
+#include "../areas/bounds.tpp"
 #include "../linear/matrix.tpp"
 #include "../linear/vector.tpp"
 #include "../points/point.tpp"
 #include "../points/segment.tpp"
+#include "../scalar/slice.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
 
 using namespace planar;
 
@@ -65,6 +73,25 @@ TEST(Bounds, Enclose) {
         ),
         Bounds(1, 1, 4, 4)
     );
+
+    EXPECT_EQ(Bounds::enclose(std::vector<Point<double>>()), Bounds());
+
+    std::vector<Point<double>> points;
+    std::vector<double> x;
+    std::vector<double> y;
+
+    for (size_t i = 0; i < 3 * Bounds::threshold; ++i) {
+        auto k = static_cast<double>(i);
+
+        points.emplace_back(k + 2, k - 5);
+        x.push_back(k + 2);
+        y.push_back(k - 5);
+    }
+
+    auto last = static_cast<double>(3 * Bounds::threshold - 1);
+
+    EXPECT_EQ(Bounds::enclose(points, 4), Bounds(2, -5, last, last));
+    EXPECT_EQ(Bounds::enclose(x, y, 4), Bounds(2, -5, last, last));
 }
 
 TEST(Bounds, Operators) {
@@ -99,55 +126,55 @@ TEST(Bounds, Empty) {
 TEST(Bounds, Corners) {
     EXPECT_EQ(
         Bounds(1.0, 1.0, 1.0, 1.0).corners(), 
-        std::vector<Point<double>>({
+        (std::array<Point<double>, 4>{{
             {1.0, 1.0},
             {2.0, 1.0},
             {1.0, 2.0},
             {2.0, 2.0},
-        })
+        }})
     );
 
     EXPECT_EQ(
         Bounds(1.0, 1.0, 2.0, 3.0).corners(), 
-        std::vector<Point<double>>({
+        (std::array<Point<double>, 4>{{
             {1.0, 1.0},
             {3.0, 1.0},
             {1.0, 4.0},
             {3.0, 4.0},
-        })
+        }})
     );
 }
 
 TEST(Bounds, Midpoints) {
     EXPECT_EQ(Bounds(1.0, 1.0, 1.0, 1.0).midpoints(),
-        std::vector<Point<double>>({
+        (std::array<Point<double>, 4>{{
             {1.5, 1.0},
             {1.0, 1.5},
             {2.0, 1.5},
             {1.5, 2.0},
-        })
+        }})
     );
 
 
     EXPECT_EQ(Bounds(1.0, 1.0, 2.0, 3.0).midpoints(),
-        std::vector<Point<double>>({
+        (std::array<Point<double>, 4>{{
             {2.0, 1.0},
             {1.0, 2.5},
             {3.0, 2.5},
             {2.0, 4.0},
-        })
+        }})
     );
 }
 
 TEST(Bounds, Segments) {
     EXPECT_EQ(
         Bounds(1.0, 1.0, 1.0, 1.0).segments(), 
-        std::vector<Segment<double>>({
+        (std::array<Segment<double>, 4>{{
             {{1.0, 1.0}, {2.0, 1.0}},
             {{1.0, 1.0}, {1.0, 2.0}},
             {{2.0, 1.0}, {2.0, 2.0}},
             {{1.0, 2.0}, {2.0, 2.0}},
-        })
+        }})
      );
 }
 
@@ -163,6 +190,10 @@ TEST(Bounds, Overlaps) {
     EXPECT_TRUE(Bounds(0.0, 0.0, 1.0, 1.0).overlaps({0.5, 0.5, 1.0, 1.0}));
     EXPECT_TRUE(Bounds(0.0, 0.0, 1.0, 1.0).overlaps({1.0, 1.0, 1.0, 1.0}));
     EXPECT_FALSE(Bounds(0.0, 0.0, 1.0, 1.0).overlaps({2.0, 2.0, 1.0, 1.0}));
+
+    EXPECT_TRUE(Bounds(0.0, 0.0, 4.0, 4.0).overlaps({1.0, 1.0, 1.0, 1.0}));
+    EXPECT_TRUE(Bounds(1.0, 0.0, 1.0, 4.0).overlaps({0.0, 1.0, 4.0, 1.0}));
+    EXPECT_FALSE(Bounds(0.0, 0.0, 1.0, 1.0).overlaps({0.0, 2.0, 1.0, 1.0}));
 }
 
 TEST(Bounds, Center) {
@@ -228,6 +259,21 @@ TEST(Bounds, Slice) {
         Bounds(0.0, 0.0, 10.0, 10.0).slice({2, 4}, {0, 1}, {2, 4}),
         Bounds(5.0, 0.0, 5.0, 5.0)
     );
+
+    std::vector<std::pair<Slice, Slice>> spans({
+        {{0, 1}, {0, 4}},
+        {{1, 2}, {0, 1}},
+        {{1, 2}, {1, 4}},
+    });
+
+    EXPECT_EQ(
+        Bounds(0.0, 0.0, 10.0, 10.0).slice({2, 4}, spans),
+        std::vector<Bounds>({
+            {0.0, 0.0, 10.0, 5.0},
+            {0.0, 5.0, 2.5, 5.0},
+            {2.5, 5.0, 7.5, 5.0},
+        })
+    );
 }
 
 TEST(Bounds, SplitWidth) {
@@ -298,6 +344,87 @@ TEST(Bounds, Cols) {
     );
 }
 
+TEST(Bounds, SampleOutput) {
+    Bounds bounds(0.0, 0.0, 10.0, 10.0);
+
+    std::array<Point<double>, 4> buffer{};
+    bounds.sample(2, buffer);
+    EXPECT_TRUE(std::ranges::equal(buffer, bounds.sample(2)));
+
+    std::vector<Point<double>> points;
+    bounds.sample(2, std::back_inserter(points));
+    EXPECT_EQ(points, bounds.sample(2));
+
+    std::array<Point<double>, 3> small{};
+    EXPECT_THROW(bounds.sample(2, small), std::length_error);
+}
+
+TEST(Bounds, DivisionOutput) {
+    Bounds bounds(0.0, 0.0, 3.0, 3.0);
+
+    std::array<Bounds, 3> rows{};
+    bounds.rows(3, rows);
+    EXPECT_TRUE(std::ranges::equal(rows, bounds.rows(3)));
+
+    std::vector<Bounds> cols;
+    bounds.cols(3, std::back_inserter(cols));
+    EXPECT_EQ(cols, bounds.cols(3));
+
+    std::array<Bounds, 2> small{};
+    EXPECT_THROW(bounds.cols(3, small), std::length_error);
+}
+
+TEST(Bounds, CellOutput) {
+    Bounds bounds(0.0, 0.0, 4.0, 4.0);
+
+    std::array<Bounds, 4> tiles{};
+    bounds.tile({2, 2}, {1.0, 1.0}, tiles);
+    EXPECT_TRUE(std::ranges::equal(tiles, bounds.tile({2, 2}, {1.0, 1.0})));
+
+    std::vector<Bounds> cells;
+    bounds.grid({2, 2}, {0.5, 0.5}, {1.0, 1.0}, std::back_inserter(cells));
+    EXPECT_TRUE(std::ranges::equal(cells, bounds.grid({2, 2}, {0.5, 0.5}, {1.0, 1.0})));
+
+    std::vector<std::pair<Slice, Slice>> spans({
+        {{0, 1}, {0, 2}},
+        {{1, 2}, {1, 2}},
+    });
+
+    std::array<Bounds, 2> slices{};
+    bounds.slice({2, 2}, spans, slices);
+    EXPECT_TRUE(std::ranges::equal(slices, bounds.slice({2, 2}, spans)));
+
+    std::array<Bounds, 3> small{};
+    EXPECT_THROW(bounds.grid({2, 2}, {0.0, 0.0}, {0.0, 0.0}, small), std::length_error);
+    EXPECT_THROW(bounds.slice({2, 2}, spans, std::span(small).first(1)), std::length_error);
+}
+
+TEST(Bounds, Resource) {
+    std::array<std::byte, 1024> arena{};
+    std::pmr::monotonic_buffer_resource resource(arena.data(), arena.size(), std::pmr::null_memory_resource());
+
+    Bounds bounds(0.0, 0.0, 10.0, 10.0);
+
+    auto points = bounds.sample(2, &resource);
+    EXPECT_EQ(points.get_allocator().resource(), &resource);
+    EXPECT_TRUE(std::ranges::equal(points, bounds.sample(2)));
+
+    EXPECT_TRUE(std::ranges::equal(bounds.rows(2, &resource), bounds.rows(2)));
+    EXPECT_TRUE(std::ranges::equal(bounds.cols(2, &resource), bounds.cols(2)));
+
+    EXPECT_TRUE(std::ranges::equal(bounds.tile({2, 2}, {0.0, 0.0}, &resource), bounds.tile({2, 2})));
+    EXPECT_TRUE(std::ranges::equal(
+        bounds.grid({2, 2}, {0.0, 0.0}, {1.0, 1.0}, &resource),
+        bounds.grid({2, 2}, {0.0, 0.0}, {1.0, 1.0})
+    ));
+
+    std::vector<std::pair<Slice, Slice>> spans({{{0, 1}, {0, 2}}});
+    EXPECT_TRUE(std::ranges::equal(bounds.slice({2, 2}, spans, &resource), bounds.slice({2, 2}, spans)));
+
+    std::vector<Bounds> boxes({{0.0, 0.0, 2.0, 2.0}, {1.0, 1.0, 2.0, 2.0}});
+    EXPECT_TRUE(std::ranges::equal(Bounds::overlapping_pairs(boxes, &resource), Bounds::overlapping_pairs(boxes)));
+}
+
 TEST(Bounds, Tile) {
     EXPECT_EQ(
         Bounds(0.0, 0.0, 1.0, 1.0).tile({2, 2}),
@@ -350,3 +477,17 @@ TEST(Bounds, Grid) {
         })
     );
 }
+
+TEST(Bounds, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Bounds>);
+    static_assert(std::is_nothrow_default_constructible_v<Bounds>);
+
+    constexpr Bounds page(0, 0, 10, 20);
+    constexpr auto header = page.split_height(4).first.pad({2, 2});
+
+    static_assert(header == Bounds(1, 1, 8, 2));
+    static_assert(header.center() == Point(5.0, 2.0));
+    static_assert(page.contains(header.center()));
+    static_assert(!header.overlaps(page.shift({20, 0})));
+    static_assert(page.constrain({5, 5}) == Bounds(2.5, 7.5, 5, 5));
+}
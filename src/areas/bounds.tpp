@@ -0,0 +1,40 @@
+#ifndef PLANAR_AREAS_BOUNDS_TPP
+#define PLANAR_AREAS_BOUNDS_TPP
+
+#include "bounds.hpp"
+#include "views.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+template <std::output_iterator<planar::Point<double>> Iterator>
+Iterator planar::Bounds::sample(size_t side, Iterator output) const {
+    return std::ranges::copy(sample_view(side), output).out;
+}
+
+template <std::output_iterator<planar::Bounds> Iterator>
+Iterator planar::Bounds::rows(size_t n, Iterator output) const {
+    return std::ranges::copy(rows_view(n), output).out;
+}
+
+template <std::output_iterator<planar::Bounds> Iterator>
+Iterator planar::Bounds::cols(size_t n, Iterator output) const {
+    return std::ranges::copy(cols_view(n), output).out;
+}
+
+template <std::output_iterator<planar::Bounds> Iterator>
+Iterator planar::Bounds::tile(const Dimensions &dimensions, const Size<double> &padding, Iterator output) const {
+    return std::ranges::copy(tile_view(dimensions, padding), output).out;
+}
+
+template <std::output_iterator<planar::Bounds> Iterator>
+Iterator planar::Bounds::grid(
+    const Dimensions &dimensions,
+    const Size<double> &padding,
+    const Size<double> &margin,
+    Iterator output
+) const {
+    return std::ranges::copy(grid_view(dimensions, padding, margin), output).out;
+}
+
+#endif
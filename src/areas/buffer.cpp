@@ -0,0 +1,168 @@
+#include "buffer.hpp"
+#include "../points/buffer.hpp"
+#include "../points/point.tpp"
+#include "../scalar/compact.tpp"
+#include "../scalar/length.hpp"
+#include "bounds.hpp"
+#include "size.tpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+planar::BoundsBuffer::BoundsBuffer(std::span<const Bounds> bounds) {
+    x.reserve(bounds.size());
+    y.reserve(bounds.size());
+    w.reserve(bounds.size());
+    h.reserve(bounds.size());
+
+    for (const auto &item : bounds) {
+        push_back(item);
+    }
+}
+
+bool planar::BoundsBuffer::operator==(const BoundsBuffer &rhs) const {
+    return x == rhs.x && y == rhs.y && w == rhs.w && h == rhs.h;
+}
+
+bool planar::BoundsBuffer::operator!=(const BoundsBuffer &rhs) const {
+    return !(*this == rhs);
+}
+
+planar::Bounds planar::BoundsBuffer::operator[](size_t index) const {
+    return {x[index], y[index], w[index], h[index]};
+}
+
+size_t planar::BoundsBuffer::size() const {
+    return x.size();
+}
+
+bool planar::BoundsBuffer::empty() const {
+    return x.empty();
+}
+
+void planar::BoundsBuffer::clear() {
+    x.clear();
+    y.clear();
+    w.clear();
+    h.clear();
+}
+
+void planar::BoundsBuffer::push_back(const Bounds &bounds) {
+    x.push_back(bounds.point.x());
+    y.push_back(bounds.point.y());
+    w.push_back(bounds.size.width());
+    h.push_back(bounds.size.height());
+}
+
+std::vector<planar::Bounds> planar::BoundsBuffer::bounds() const {
+    std::vector<Bounds> output;
+    output.reserve(size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        output.emplace_back(x[i], y[i], w[i], h[i]);
+    }
+
+    return output;
+}
+
+std::pmr::vector<planar::Bounds> planar::BoundsBuffer::bounds(std::pmr::memory_resource *resource) const {
+    std::pmr::vector<Bounds> output(resource);
+    output.reserve(size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        output.emplace_back(x[i], y[i], w[i], h[i]);
+    }
+
+    return output;
+}
+
+void planar::BoundsBuffer::bounds(std::span<Bounds> output) const {
+    require(output.size(), size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        output[i] = Bounds(x[i], y[i], w[i], h[i]);
+    }
+}
+
+void planar::BoundsBuffer::contains(const Point<double> &point, std::span<std::uint8_t> mask) const {
+    auto px = point.x();
+    auto py = point.y();
+
+    require(mask.size(), size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        mask[i] = static_cast<std::uint8_t>((x[i] <= px) & (px <= x[i] + w[i]) & (y[i] <= py) & (py <= y[i] + h[i]));
+    }
+}
+
+void planar::BoundsBuffer::contains(const Point<double> &point, std::vector<size_t> &indices) const {
+    auto px = point.x();
+    auto py = point.y();
+
+    compact(size(), indices, [this, px, py](size_t i) {
+        return (x[i] <= px) & (px <= x[i] + w[i]) & (y[i] <= py) & (py <= y[i] + h[i]);
+    });
+}
+
+void planar::BoundsBuffer::overlaps(const Bounds &bounds, std::span<std::uint8_t> mask) const {
+    auto left   = bounds.point.x();
+    auto top    = bounds.point.y();
+    auto right  = left + bounds.size.width();
+    auto bottom = top + bounds.size.height();
+
+    require(mask.size(), size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        mask[i] = static_cast<std::uint8_t>(
+            (x[i] <= right) & (left <= x[i] + w[i]) & (y[i] <= bottom) & (top <= y[i] + h[i])
+        );
+    }
+}
+
+void planar::BoundsBuffer::overlaps(const Bounds &bounds, std::vector<size_t> &indices) const {
+    auto left   = bounds.point.x();
+    auto top    = bounds.point.y();
+    auto right  = left + bounds.size.width();
+    auto bottom = top + bounds.size.height();
+
+    compact(size(), indices, [this, left, top, right, bottom](size_t i) {
+        return (x[i] <= right) & (left <= x[i] + w[i]) & (y[i] <= bottom) & (top <= y[i] + h[i]);
+    });
+}
+
+void planar::BoundsBuffer::shift(const Size<double> &offset) {
+    auto dx = offset.width();
+    auto dy = offset.height();
+
+    for (auto &value : x) {
+        value += dx;
+    }
+
+    for (auto &value : y) {
+        value += dy;
+    }
+}
+
+void planar::BoundsBuffer::scale(const Size<double> &factor) {
+    auto fx = factor.width();
+    auto fy = factor.height();
+
+    for (size_t i = 0; i < size(); ++i) {
+        x[i] -= w[i] * (fx - 1) / 2;
+        y[i] -= h[i] * (fy - 1) / 2;
+        w[i] *= fx;
+        h[i] *= fy;
+    }
+}
+
+void planar::BoundsBuffer::center(PointBuffer &output) const {
+    output.x.resize(size());
+    output.y.resize(size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        output.x[i] = x[i] + w[i] / 2;
+        output.y[i] = y[i] + h[i] / 2;
+    }
+}
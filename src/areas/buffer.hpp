@@ -0,0 +1,63 @@
+#ifndef PLANAR_AREAS_BUFFER_HPP
+#define PLANAR_AREAS_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace planar {
+    class Bounds;
+    class PointBuffer;
+
+    template <typename T>
+    class Point;
+
+    template <typename T>
+    class Size;
+
+    class BoundsBuffer {
+      public:
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> w;
+        std::vector<double> h;
+
+        BoundsBuffer() = default;
+
+        explicit BoundsBuffer(std::span<const Bounds> bounds);
+
+        bool operator==(const BoundsBuffer &rhs) const;
+        bool operator!=(const BoundsBuffer &rhs) const;
+
+        Bounds operator[](size_t index) const;
+
+        size_t size() const;
+
+        bool empty() const;
+
+        void clear();
+
+        void push_back(const Bounds &bounds);
+
+        std::vector<Bounds> bounds() const;
+        std::pmr::vector<Bounds> bounds(std::pmr::memory_resource *resource) const;
+
+        void bounds(std::span<Bounds> output) const;
+
+        void contains(const Point<double> &point, std::span<std::uint8_t> mask) const;
+        void contains(const Point<double> &point, std::vector<size_t> &indices) const;
+
+        void overlaps(const Bounds &bounds, std::span<std::uint8_t> mask) const;
+        void overlaps(const Bounds &bounds, std::vector<size_t> &indices) const;
+
+        void shift(const Size<double> &offset);
+
+        void scale(const Size<double> &factor);
+
+        void center(PointBuffer &output) const;
+    };
+}
+
+#endif
@@ -0,0 +1,116 @@
+#include "buffer.hpp"
+#include "../points/buffer.hpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+using namespace planar;
+
+namespace {
+    std::vector<Bounds> boxes() {
+        return {
+            {0.0, 0.0, 1.0, 1.0},
+            {1.0, 0.0, 4.0, 1.0},
+            {0.0, 2.0, 2.0, 2.0},
+            {5.0, 5.0, 1.0, 1.0},
+        };
+    }
+}
+
+TEST(BoundsBuffer, Bounds) {
+    auto bounds = boxes();
+    BoundsBuffer buffer(bounds);
+
+    EXPECT_EQ(buffer.size(), 4);
+    EXPECT_EQ(buffer[2], Bounds(0.0, 2.0, 2.0, 2.0));
+    EXPECT_EQ(buffer.bounds(), bounds);
+
+    std::pmr::monotonic_buffer_resource resource;
+    EXPECT_TRUE(std::ranges::equal(buffer.bounds(&resource), bounds));
+
+    std::vector<Bounds> output(buffer.size());
+    buffer.bounds(output);
+    EXPECT_EQ(output, bounds);
+
+    std::vector<Bounds> small(buffer.size() - 1);
+    EXPECT_THROW(buffer.bounds(small), std::length_error);
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(BoundsBuffer, Contains) {
+    auto bounds = boxes();
+    BoundsBuffer buffer(bounds);
+
+    for (const auto &point : {Point(0.5, 0.5), Point(1.0, 1.0), Point(5.5, 5.5), Point(9.0, 9.0)}) {
+        std::vector<std::uint8_t> mask(buffer.size());
+        buffer.contains(point, mask);
+
+        std::vector<size_t> indices;
+        buffer.contains(point, indices);
+
+        std::vector<size_t> expected;
+
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            EXPECT_EQ(mask[i] == 1, bounds[i].contains(point));
+
+            if (bounds[i].contains(point)) {
+                expected.push_back(i);
+            }
+        }
+
+        EXPECT_EQ(indices, expected);
+    }
+
+    std::vector<std::uint8_t> small(buffer.size() - 1);
+    EXPECT_THROW(buffer.contains(Point(0.5, 0.5), small), std::length_error);
+}
+
+TEST(BoundsBuffer, Overlaps) {
+    auto bounds = boxes();
+    BoundsBuffer buffer(bounds);
+
+    for (const auto &region : {Bounds(0.5, 0.5, 1.0, 2.0), Bounds(2.0, -1.0, 0.5, 5.0), Bounds(7.0, 7.0, 1.0, 1.0)}) {
+        std::vector<std::uint8_t> mask(buffer.size());
+        buffer.overlaps(region, mask);
+
+        std::vector<size_t> indices;
+        buffer.overlaps(region, indices);
+
+        std::vector<size_t> expected;
+
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            EXPECT_EQ(mask[i] == 1, bounds[i].overlaps(region));
+
+            if (bounds[i].overlaps(region)) {
+                expected.push_back(i);
+            }
+        }
+
+        EXPECT_EQ(indices, expected);
+    }
+}
+
+TEST(BoundsBuffer, Transform) {
+    auto bounds = boxes();
+    BoundsBuffer buffer(bounds);
+
+    buffer.shift({1.0, 2.0});
+    EXPECT_EQ(buffer[1], bounds[1].shift({1.0, 2.0}));
+
+    buffer.scale({2.0, 4.0});
+    EXPECT_EQ(buffer[0], bounds[0].shift({1.0, 2.0}).scale({2.0, 4.0}));
+
+    PointBuffer centers;
+    buffer.center(centers);
+
+    EXPECT_EQ(centers.size(), 4);
+    EXPECT_EQ(centers[3], buffer[3].center());
+}
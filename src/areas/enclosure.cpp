@@ -0,0 +1,134 @@
+#include "enclosure.hpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <utility>
+
+namespace {
+    constexpr auto infinity = std::numeric_limits<double>::infinity();
+
+    using Pair = double __attribute__((vector_size(2 * sizeof(double))));
+
+    static_assert(sizeof(planar::Point<double>) == sizeof(Pair));
+
+    double lower(double a, double b) {
+        return b < a ? b : a;
+    }
+
+    double upper(double a, double b) {
+        return a < b ? b : a;
+    }
+
+    Pair lower(Pair a, Pair b) {
+        return b < a ? b : a;
+    }
+
+    Pair upper(Pair a, Pair b) {
+        return a < b ? b : a;
+    }
+
+    // Folds a contiguous run of doubles into the extremes of its even and odd
+    // elements, which are the x and y of interleaved points.
+    std::pair<Pair, Pair> fold(const void *data, size_t size) {
+        constexpr auto lanes = planar::Enclosure::lanes;
+        constexpr auto width = lanes / 2;
+
+        const auto *bytes = static_cast<const char *>(data);
+
+        std::array<Pair, width> low{};
+        std::array<Pair, width> high{};
+
+        low.fill(Pair{infinity, infinity});
+        high.fill(Pair{-infinity, -infinity});
+
+        size_t i = 0;
+
+        for (; i + lanes <= size; i += lanes) {
+            for (size_t lane = 0; lane < width; ++lane) {
+                Pair value;
+                std::memcpy(&value, bytes + (i + lane * 2) * sizeof(double), sizeof(Pair));
+
+                low[lane]  = lower(low[lane], value);
+                high[lane] = upper(high[lane], value);
+            }
+        }
+
+        for (size_t lane = 1; lane < width; ++lane) {
+            low[0]  = lower(low[0], low[lane]);
+            high[0] = upper(high[0], high[lane]);
+        }
+
+        for (; i < size; ++i) {
+            double value;
+            std::memcpy(&value, bytes + i * sizeof(double), sizeof(double));
+
+            low[0][i % 2]  = lower(low[0][i % 2], value);
+            high[0][i % 2] = upper(high[0][i % 2], value);
+        }
+
+        return {low[0], high[0]};
+    }
+}
+
+planar::Enclosure::Enclosure() : left(infinity), top(infinity), right(-infinity), bottom(-infinity) {
+}
+
+bool planar::Enclosure::operator==(const Enclosure &rhs) const {
+    return left == rhs.left && top == rhs.top && right == rhs.right && bottom == rhs.bottom;
+}
+
+bool planar::Enclosure::operator!=(const Enclosure &rhs) const {
+    return !(*this == rhs);
+}
+
+bool planar::Enclosure::empty() const {
+    return right < left;
+}
+
+void planar::Enclosure::add(const Point<double> &point) {
+    left   = lower(left, point.x());
+    top    = lower(top, point.y());
+    right  = upper(right, point.x());
+    bottom = upper(bottom, point.y());
+}
+
+void planar::Enclosure::add(std::span<const Point<double>> points) {
+    auto [low, high] = fold(points.data(), points.size() * 2);
+
+    left   = lower(left, low[0]);
+    top    = lower(top, low[1]);
+    right  = upper(right, high[0]);
+    bottom = upper(bottom, high[1]);
+}
+
+void planar::Enclosure::add(std::span<const double> x, std::span<const double> y) {
+    auto size = std::min(x.size(), y.size());
+
+    auto [xlow, xhigh] = fold(x.data(), size);
+    auto [ylow, yhigh] = fold(y.data(), size);
+
+    left   = lower(left, lower(xlow[0], xlow[1]));
+    top    = lower(top, lower(ylow[0], ylow[1]));
+    right  = upper(right, upper(xhigh[0], xhigh[1]));
+    bottom = upper(bottom, upper(yhigh[0], yhigh[1]));
+}
+
+void planar::Enclosure::merge(const Enclosure &other) {
+    left   = lower(left, other.left);
+    top    = lower(top, other.top);
+    right  = upper(right, other.right);
+    bottom = upper(bottom, other.bottom);
+}
+
+planar::Bounds planar::Enclosure::bounds() const {
+    if (empty()) {
+        return {};
+    }
+
+    return {left, top, right - left, bottom - top};
+}
@@ -0,0 +1,43 @@
+#ifndef PLANAR_AREAS_ENCLOSURE_HPP
+#define PLANAR_AREAS_ENCLOSURE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+namespace planar {
+    class Bounds;
+
+    template <typename T>
+    class Point;
+
+    class Enclosure {
+      public:
+        static constexpr size_t lanes = 8;
+
+        double left;
+        double top;
+        double right;
+        double bottom;
+
+        Enclosure();
+
+        bool operator==(const Enclosure &rhs) const;
+        bool operator!=(const Enclosure &rhs) const;
+
+        bool empty() const;
+
+        void add(const Point<double> &point);
+        void add(std::span<const Point<double>> points);
+        void add(std::span<const double> x, std::span<const double> y);
+
+        template <std::input_iterator Iterator>
+        void add(Iterator first, Iterator last);
+
+        void merge(const Enclosure &other);
+
+        Bounds bounds() const;
+    };
+}
+
+#endif
@@ -0,0 +1,90 @@
+#include "enclosure.tpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace planar;
+
+TEST(Enclosure, Empty) {
+    Enclosure enclosure;
+
+    EXPECT_TRUE(enclosure.empty());
+    EXPECT_EQ(enclosure.bounds(), Bounds());
+
+    enclosure.add(Point<double>(2, 3));
+
+    EXPECT_FALSE(enclosure.empty());
+    EXPECT_EQ(enclosure.bounds(), Bounds(2, 3, 0, 0));
+}
+
+TEST(Enclosure, Add) {
+    std::vector<Point<double>> points({
+        {-1, 4},
+        {3, -2},
+        {0, 0},
+        {5, 1},
+        {2, 7},
+        {-3, 2},
+        {1, 1}
+    });
+
+    Enclosure spans;
+    spans.add(points);
+
+    Enclosure iterators;
+    iterators.add(points.begin(), points.end());
+
+    EXPECT_EQ(spans.bounds(), Bounds(-3, -2, 8, 9));
+    EXPECT_EQ(spans, iterators);
+
+    std::vector<double> x({-1, 3, 0, 5, 2, -3, 1});
+    std::vector<double> y({4, -2, 0, 1, 7, 2, 1});
+
+    Enclosure coordinates;
+    coordinates.add(x, y);
+
+    EXPECT_EQ(spans, coordinates);
+}
+
+TEST(Enclosure, Merge) {
+    Enclosure left;
+    left.add(Point<double>(0, 0));
+
+    Enclosure right;
+    right.add(Point<double>(4, -2));
+
+    Enclosure empty;
+
+    left.merge(empty);
+    EXPECT_EQ(left.bounds(), Bounds(0, 0, 0, 0));
+
+    left.merge(right);
+    EXPECT_EQ(left.bounds(), Bounds(0, -2, 4, 2));
+}
+
+TEST(Enclosure, Lanes) {
+    std::vector<Point<double>> points;
+    std::vector<double> x;
+    std::vector<double> y;
+
+    for (size_t i = 0; i < 2 * Enclosure::lanes + 3; ++i) {
+        auto value = static_cast<double>(i);
+
+        points.emplace_back(value, -value);
+        x.push_back(value);
+        y.push_back(-value);
+    }
+
+    Enclosure spans;
+    spans.add(points);
+
+    Enclosure coordinates;
+    coordinates.add(x, y);
+
+    auto last = static_cast<double>(2 * Enclosure::lanes + 2);
+
+    EXPECT_EQ(spans.bounds(), Bounds(0, -last, last, last));
+    EXPECT_EQ(spans, coordinates);
+}
@@ -0,0 +1,15 @@
+#ifndef PLANAR_AREAS_ENCLOSURE_TPP
+#define PLANAR_AREAS_ENCLOSURE_TPP
+
+#include "../points/point.tpp"
+#include "enclosure.hpp"
+#include <iterator>
+
+template <std::input_iterator Iterator>
+void planar::Enclosure::add(Iterator first, Iterator last) {
+    for (; first != last; ++first) {
+        add(static_cast<const Point<double> &>(*first));
+    }
+}
+
+#endif
@@ -0,0 +1,88 @@
+#include "grid.hpp"
+#include "../linear/matrix.tpp"
+#include "../points/point.tpp"
+#include "../scalar/dimensions.hpp"
+#include "../scalar/instrument.hpp"
+#include "../scalar/length.hpp"
+#include "../scalar/slice.hpp"
+#include "bounds.hpp"
+#include "size.tpp"
+#include "views.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace {
+    std::optional<size_t> locate(double offset, double section, double stride, size_t count) {
+        if (offset < 0 || !(stride > 0) || count == 0) {
+            return std::nullopt;
+        }
+
+        auto index = std::min(std::floor(offset / stride), static_cast<double>(count - 1));
+
+        if (offset - index * stride > section) {
+            return std::nullopt;
+        }
+
+        return static_cast<size_t>(index);
+    }
+
+    planar::Slice span(double start, double end, double section, double stride, size_t count) {
+        if (!(stride > 0) || count == 0) {
+            return {0, 0};
+        }
+
+        auto limit = static_cast<double>(count);
+
+        auto first = std::clamp(std::ceil((start - section) / stride), 0.0, limit);
+        auto last  = std::clamp(std::floor(end / stride) + 1, 0.0, limit);
+
+        if (last <= first) {
+            return {0, 0};
+        }
+
+        return {static_cast<size_t>(first), static_cast<size_t>(last)};
+    }
+}
+
+std::optional<planar::Point<size_t>> planar::Grid::cell_at(const Point<double> &point) const {
+    auto col = locate(point.x() - origin.x(), section.width(), stride.width(), dimensions.cols);
+    auto row = locate(point.y() - origin.y(), section.height(), stride.height(), dimensions.rows);
+
+    if (!col || !row) {
+        return std::nullopt;
+    }
+
+    return Point<size_t>(*col, *row);
+}
+
+std::pair<planar::Slice, planar::Slice> planar::Grid::visible(const Bounds &viewport) const {
+    auto left = viewport.point.x() - origin.x();
+    auto top  = viewport.point.y() - origin.y();
+
+    return {
+        span(top, top + viewport.size.height(), section.height(), stride.height(), dimensions.rows),
+        span(left, left + viewport.size.width(), section.width(), stride.width(), dimensions.cols),
+    };
+}
+
+void planar::Grid::slice(std::span<const std::pair<planar::Slice, planar::Slice>> spans, std::span<Bounds> output)
+    const {
+    require(output.size(), spans.size());
+
+    for (size_t i = 0; i < spans.size(); ++i) {
+        output[i] = slice(spans[i].first, spans[i].second);
+    }
+}
+
+planar::Matrix<planar::Bounds> planar::Grid::matrix() const {
+    PLANAR_MEASURE("Grid::matrix");
+    PLANAR_COUNT(dimensions.rows * dimensions.cols);
+
+    Matrix<Bounds> cells(dimensions, Bounds());
+    std::ranges::copy(CellView(*this), cells.begin());
+    return cells;
+}
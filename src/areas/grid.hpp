@@ -0,0 +1,116 @@
+#ifndef PLANAR_AREAS_GRID_HPP
+#define PLANAR_AREAS_GRID_HPP
+
+#include "../points/point.hpp"
+#include "../scalar/dimensions.hpp"
+#include "../scalar/slice.hpp"
+#include "bounds.hpp"
+#include "size.tpp"
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace planar {
+    template <typename T>
+    class Matrix;
+
+    class Grid {
+      public:
+        Point<double> origin;
+        Size<double> section;
+        Size<double> stride;
+        Dimensions dimensions;
+
+        constexpr Grid(
+            const Point<double> &origin,
+            const Size<double> &section,
+            const Size<double> &stride,
+            const Dimensions &dimensions
+        ) noexcept;
+
+        constexpr Grid(
+            const Bounds &bounds,
+            const Dimensions &dimensions,
+            const Size<double> &padding = {0.0, 0.0},
+            const Size<double> &margin  = {0.0, 0.0}
+        ) noexcept;
+
+        constexpr bool operator==(const Grid &rhs) const noexcept;
+        constexpr bool operator!=(const Grid &rhs) const noexcept;
+
+        constexpr Bounds cell(size_t row, size_t col) const noexcept;
+
+        constexpr Bounds slice(const planar::Slice &rows, const planar::Slice &cols) const;
+        void slice(std::span<const std::pair<planar::Slice, planar::Slice>> spans, std::span<Bounds> output) const;
+
+        std::optional<Point<size_t>> cell_at(const Point<double> &point) const;
+
+        std::pair<planar::Slice, planar::Slice> visible(const Bounds &viewport) const;
+
+        Matrix<Bounds> matrix() const;
+    };
+}
+
+constexpr planar::Grid::Grid(
+    const Point<double> &origin,
+    const Size<double> &section,
+    const Size<double> &stride,
+    const Dimensions &dimensions
+) noexcept
+    : origin(origin)
+    , section(section)
+    , stride(stride)
+    , dimensions(dimensions) {
+}
+
+constexpr planar::Grid::Grid(
+    const Bounds &bounds,
+    const Dimensions &dimensions,
+    const Size<double> &padding,
+    const Size<double> &margin
+) noexcept
+    : origin(bounds.point + padding + margin)
+    , section(
+          (bounds.size.width() - 2 * margin.width()) / static_cast<double>(dimensions.cols) - 2 * padding.width(),
+          (bounds.size.height() - 2 * margin.height()) / static_cast<double>(dimensions.rows) - 2 * padding.height()
+      )
+    , stride(section + padding * 2)
+    , dimensions(dimensions) {
+}
+
+constexpr bool planar::Grid::operator==(const Grid &rhs) const noexcept {
+    return origin == rhs.origin && section == rhs.section && stride == rhs.stride && dimensions == rhs.dimensions;
+}
+
+constexpr bool planar::Grid::operator!=(const Grid &rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr planar::Bounds planar::Grid::cell(size_t row, size_t col) const noexcept {
+    auto x = static_cast<double>(col);
+    auto y = static_cast<double>(row);
+
+    return {
+        {origin.x() + stride.width() * x, origin.y() + stride.height() * y},
+        section
+    };
+}
+
+constexpr planar::Bounds planar::Grid::slice(const planar::Slice &rows, const planar::Slice &cols) const {
+    auto bottom = std::min(rows.end, dimensions.rows);
+    auto right  = std::min(cols.end, dimensions.cols);
+
+    if (bottom <= rows.start || right <= cols.start) {
+        throw std::out_of_range("Grid slice is empty");
+    }
+
+    auto first = cell(rows.start, cols.start);
+    auto last  = cell(bottom - 1, right - 1);
+
+    return {first.point, last.point.projection() - first.point.projection() + last.size};
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include "grid.hpp"
+#include "../linear/matrix.tpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace planar;
+
+TEST(Grid, Cell) {
+    Grid grid(Bounds(0.0, 0.0, 10.0, 10.0), {2, 2}, {1.0, 1.0}, {1.0, 1.0});
+
+    EXPECT_EQ(grid.cell(0, 0), Bounds(2.0, 2.0, 2.0, 2.0));
+    EXPECT_EQ(grid.cell(0, 1), Bounds(6.0, 2.0, 2.0, 2.0));
+    EXPECT_EQ(grid.cell(1, 0), Bounds(2.0, 6.0, 2.0, 2.0));
+    EXPECT_EQ(grid.cell(1, 1), Bounds(6.0, 6.0, 2.0, 2.0));
+}
+
+TEST(Grid, CellAt) {
+    Grid grid(Bounds(0.0, 0.0, 10.0, 10.0), {2, 2}, {1.0, 1.0}, {1.0, 1.0});
+
+    EXPECT_EQ(grid.cell_at({3.0, 3.0}), Point<size_t>(0, 0));
+    EXPECT_EQ(grid.cell_at({7.0, 3.0}), Point<size_t>(1, 0));
+    EXPECT_EQ(grid.cell_at({3.0, 7.0}), Point<size_t>(0, 1));
+    EXPECT_EQ(grid.cell_at({8.0, 8.0}), Point<size_t>(1, 1));
+
+    EXPECT_FALSE(grid.cell_at({5.0, 3.0}).has_value());
+    EXPECT_FALSE(grid.cell_at({1.0, 1.0}).has_value());
+    EXPECT_FALSE(grid.cell_at({9.0, 9.0}).has_value());
+}
+
+TEST(Grid, CellAtEdge) {
+    Bounds bounds(0.0, 0.0, 10.0, 10.0);
+    Grid grid(bounds, {2, 2});
+
+    EXPECT_TRUE(bounds.contains({10.0, 10.0}));
+    EXPECT_EQ(grid.cell_at({10.0, 10.0}), Point<size_t>(1, 1));
+    EXPECT_EQ(grid.cell_at({10.0, 0.0}), Point<size_t>(1, 0));
+    EXPECT_EQ(grid.cell_at({5.0, 10.0}), Point<size_t>(1, 1));
+
+    EXPECT_FALSE(grid.cell_at({10.5, 10.0}).has_value());
+    EXPECT_FALSE(Grid(bounds, {0, 0}).cell_at({0.0, 0.0}).has_value());
+}
+
+TEST(Grid, Visible) {
+    Grid grid(Bounds(0.0, 0.0, 100.0, 100.0), {10, 20});
+
+    EXPECT_EQ(grid.visible(Bounds(12.0, 12.0, 10.0, 30.0)), std::pair(Slice(1, 5), Slice(2, 5)));
+    EXPECT_EQ(grid.visible(Bounds(-50.0, -50.0, 200.0, 200.0)), std::pair(Slice(0, 10), Slice(0, 20)));
+    EXPECT_EQ(grid.visible(Bounds(200.0, 200.0, 10.0, 10.0)), std::pair(Slice(0, 0), Slice(0, 0)));
+}
+
+TEST(Grid, Matrix) {
+    Bounds bounds(0.0, 0.0, 10.0, 10.0);
+
+    EXPECT_EQ(Grid(bounds, {4, 2}).matrix(), bounds.grid({4, 2}));
+    EXPECT_EQ(Grid(bounds, {4, 2}).matrix().get({1, 3}), Bounds(5.0, 7.5, 5.0, 2.5));
+}
+
+TEST(Grid, Slice) {
+    Grid grid(Bounds(0.0, 0.0, 20.0, 10.0), {3, 5}, {1.0, 1.0}, {0.0, 1.0});
+
+    for (size_t top = 0; top < 3; ++top) {
+        for (size_t left = 0; left < 5; ++left) {
+            for (size_t bottom = top + 1; bottom <= 4; ++bottom) {
+                for (size_t right = left + 1; right <= 6; ++right) {
+                    EXPECT_EQ(
+                        grid.slice({top, bottom}, {left, right}),
+                        Bounds(grid.matrix().slice({top, bottom}, {left, right}))
+                    );
+                }
+            }
+        }
+    }
+
+    EXPECT_THROW(grid.slice({3, 4}, {0, 1}), std::out_of_range);
+    EXPECT_THROW(grid.slice({1, 1}, {0, 1}), std::out_of_range);
+
+    std::vector<std::pair<Slice, Slice>> spans({
+        {{0, 1}, {0, 5}},
+        {{1, 3}, {2, 3}},
+    });
+
+    std::vector<Bounds> output(spans.size());
+    grid.slice(spans, output);
+
+    EXPECT_EQ(output[0], grid.slice({0, 1}, {0, 5}));
+    EXPECT_EQ(output[1], grid.slice({1, 3}, {2, 3}));
+
+    std::vector<Bounds> small(1);
+    EXPECT_THROW(grid.slice(spans, small), std::length_error);
+}
+
+TEST(Grid, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Grid>);
+
+    constexpr Grid grid(Bounds(0.0, 0.0, 10.0, 10.0), {2, 2}, {1.0, 1.0}, {1.0, 1.0});
+
+    static_assert(grid.cell(1, 1) == Bounds(6.0, 6.0, 2.0, 2.0));
+    static_assert(grid.slice({0, 2}, {1, 2}) == Bounds(6.0, 2.0, 2.0, 6.0));
+}
@@ -0,0 +1,152 @@
+#include "rtree.hpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include "rtree.tpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+    planar::Bounds unite(std::span<const planar::Bounds> bounds) {
+        auto left   = std::numeric_limits<double>::infinity();
+        auto top    = std::numeric_limits<double>::infinity();
+        auto right  = -std::numeric_limits<double>::infinity();
+        auto bottom = -std::numeric_limits<double>::infinity();
+
+        for (const auto &item : bounds) {
+            left   = std::min(left, item.point.x());
+            top    = std::min(top, item.point.y());
+            right  = std::max(right, item.point.x() + item.size.width());
+            bottom = std::max(bottom, item.point.y() + item.size.height());
+        }
+
+        return {left, top, right - left, bottom - top};
+    }
+
+    double distance(const planar::Bounds &bounds, const planar::Point<double> &point) {
+        auto dx = std::max({bounds.point.x() - point.x(), 0.0, point.x() - bounds.point.x() - bounds.size.width()});
+        auto dy = std::max({bounds.point.y() - point.y(), 0.0, point.y() - bounds.point.y() - bounds.size.height()});
+        return dx * dx + dy * dy;
+    }
+}
+
+planar::RTree::RTree(const std::vector<Bounds> &bounds) : order(bounds.size()) {
+    std::iota(order.begin(), order.end(), 0);
+
+    auto center_x = [&bounds](size_t a, size_t b) {
+        return bounds[a].point.x() + bounds[a].size.width() / 2 < bounds[b].point.x() + bounds[b].size.width() / 2;
+    };
+
+    auto center_y = [&bounds](size_t a, size_t b) {
+        return bounds[a].point.y() + bounds[a].size.height() / 2 < bounds[b].point.y() + bounds[b].size.height() / 2;
+    };
+
+    std::sort(order.begin(), order.end(), center_x);
+
+    auto leaves = (order.size() + fanout - 1) / fanout;
+    auto slices = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(leaves))));
+    auto slab   = std::max(slices, size_t{1}) * fanout;
+
+    for (size_t start = 0; start < order.size(); start += slab) {
+        auto first = order.begin() + static_cast<std::ptrdiff_t>(start);
+        auto last  = order.begin() + static_cast<std::ptrdiff_t>(std::min(start + slab, order.size()));
+
+        std::sort(first, last, center_y);
+    }
+
+    nodes.reserve(order.size() + order.size() / (fanout - 1) + height);
+
+    for (auto index : order) {
+        nodes.push_back(bounds[index]);
+    }
+
+    levels.push_back(0);
+    levels.push_back(nodes.size());
+
+    while (count(levels.size() - 2) > 1) {
+        auto start = levels[levels.size() - 2];
+        auto end   = levels.back();
+
+        for (auto first = start; first < end; first += fanout) {
+            auto last = std::min(first + fanout, end);
+            nodes.push_back(unite(std::span(nodes).subspan(first, last - first)));
+        }
+
+        levels.push_back(nodes.size());
+    }
+}
+
+size_t planar::RTree::count(size_t level) const {
+    return levels[level + 1] - levels[level];
+}
+
+size_t planar::RTree::size() const {
+    return order.size();
+}
+
+bool planar::RTree::empty() const {
+    return order.empty();
+}
+
+planar::Bounds planar::RTree::bounds() const {
+    return empty() ? Bounds() : nodes.back();
+}
+
+size_t planar::RTree::nearest(const Point<double> &point, std::span<size_t> output) const {
+    size_t found = 0;
+
+    auto worst = [&]() {
+        return found < output.size() ? std::numeric_limits<double>::infinity()
+                                     : distance(nodes[output[found - 1]], point);
+    };
+
+    if (output.empty() || empty()) {
+        return 0;
+    }
+
+    std::array<std::pair<size_t, size_t>, height * fanout> stack{};
+    size_t depth = 0;
+
+    stack[depth++] = {levels.size() - 2, 0};
+
+    while (depth > 0) {
+        auto [level, index] = stack[--depth];
+        auto gap            = distance(nodes[levels[level] + index], point);
+
+        if (gap >= worst()) {
+            continue;
+        }
+
+        if (level == 0) {
+            auto slot = std::min(found, output.size() - 1);
+
+            while (slot > 0 && distance(nodes[output[slot - 1]], point) > gap) {
+                output[slot] = output[slot - 1];
+                --slot;
+            }
+
+            output[slot] = index;
+            found        = std::min(found + 1, output.size());
+            continue;
+        }
+
+        auto first = index * fanout;
+        auto last  = std::min(first + fanout, count(level - 1));
+
+        for (auto child = first; child < last; ++child) {
+            stack[depth++] = {level - 1, child};
+        }
+    }
+
+    for (size_t i = 0; i < found; ++i) {
+        output[i] = order[output[i]];
+    }
+
+    return found;
+}
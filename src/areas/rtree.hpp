@@ -0,0 +1,46 @@
+#ifndef PLANAR_AREAS_RTREE_HPP
+#define PLANAR_AREAS_RTREE_HPP
+
+#include "bounds.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace planar {
+    template <typename T>
+    class Point;
+
+    class RTree {
+      private:
+        std::vector<Bounds> nodes;
+        std::vector<size_t> levels;
+        std::vector<size_t> order;
+
+        size_t count(size_t level) const;
+
+        template <typename F, typename G>
+        void search(F &&accept, G &&callback) const;
+
+      public:
+        static constexpr size_t fanout = 16;
+        static constexpr size_t height = 16;
+
+        explicit RTree(const std::vector<Bounds> &bounds = {});
+
+        size_t size() const;
+
+        bool empty() const;
+
+        Bounds bounds() const;
+
+        template <typename F>
+        void overlapping(const Bounds &region, F &&callback) const;
+
+        template <typename F>
+        void containing(const Point<double> &point, F &&callback) const;
+
+        size_t nearest(const Point<double> &point, std::span<size_t> output) const;
+    };
+}
+
+#endif
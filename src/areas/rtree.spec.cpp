@@ -0,0 +1,124 @@
+#include "rtree.tpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace planar;
+
+namespace {
+    std::vector<Bounds> scatter(size_t count) {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<double> position(0, 100);
+        std::uniform_real_distribution<double> extent(0, 5);
+
+        std::vector<Bounds> bounds;
+
+        for (size_t i = 0; i < count; ++i) {
+            bounds.emplace_back(position(generator), position(generator), extent(generator), extent(generator));
+        }
+
+        return bounds;
+    }
+}
+
+TEST(RTree, Empty) {
+    RTree tree;
+
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.bounds(), Bounds());
+
+    std::vector<size_t> found;
+    tree.overlapping(Bounds(0, 0, 1, 1), [&found](size_t i) {
+        found.push_back(i);
+    });
+
+    EXPECT_TRUE(found.empty());
+}
+
+TEST(RTree, Bounds) {
+    RTree tree(std::vector<Bounds>({
+        {0, 0, 1, 1},
+        {2, 3, 1, 1}
+    }));
+
+    EXPECT_EQ(tree.size(), 2);
+    EXPECT_EQ(tree.bounds(), Bounds(0, 0, 3, 4));
+}
+
+TEST(RTree, Overlapping) {
+    auto bounds = scatter(2000);
+    RTree tree(bounds);
+
+    for (const auto &region : {Bounds(10, 10, 20, 5), Bounds(50, 0, 1, 100), Bounds(-10, -10, 5, 5)}) {
+        std::vector<size_t> found;
+        tree.overlapping(region, [&found](size_t i) {
+            found.push_back(i);
+        });
+
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            if (bounds[i].overlaps(region)) {
+                expected.push_back(i);
+            }
+        }
+
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(RTree, Containing) {
+    auto bounds = scatter(2000);
+    RTree tree(bounds);
+
+    Point<double> point(42, 17);
+
+    std::vector<size_t> found;
+    tree.containing(point, [&found](size_t i) {
+        found.push_back(i);
+    });
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        if (bounds[i].contains(point)) {
+            expected.push_back(i);
+        }
+    }
+
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, expected);
+}
+
+TEST(RTree, Nearest) {
+    auto bounds = scatter(2000);
+    RTree tree(bounds);
+
+    Point<double> point(120, 50);
+
+    auto distance = [&point](const Bounds &b) {
+        auto dx = std::max({b.point.x() - point.x(), 0.0, point.x() - b.point.x() - b.size.width()});
+        auto dy = std::max({b.point.y() - point.y(), 0.0, point.y() - b.point.y() - b.size.height()});
+        return dx * dx + dy * dy;
+    };
+
+    std::vector<double> expected;
+    for (const auto &b : bounds) {
+        expected.push_back(distance(b));
+    }
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<size_t> nearest(5);
+    EXPECT_EQ(tree.nearest(point, nearest), 5);
+
+    for (size_t i = 0; i < nearest.size(); ++i) {
+        EXPECT_EQ(distance(bounds[nearest[i]]), expected[i]);
+    }
+
+    std::vector<size_t> all(3);
+    EXPECT_EQ(RTree(std::vector<Bounds>({{0, 0, 1, 1}})).nearest(point, all), 1);
+    EXPECT_EQ(all[0], 0);
+}
@@ -0,0 +1,62 @@
+#ifndef PLANAR_AREAS_RTREE_TPP
+#define PLANAR_AREAS_RTREE_TPP
+
+#include "bounds.hpp"
+#include "rtree.hpp"
+#include <array>
+#include <cstddef>
+#include <utility>
+
+template <typename F, typename G>
+void planar::RTree::search(F &&accept, G &&callback) const {
+    if (order.empty()) {
+        return;
+    }
+
+    std::array<std::pair<size_t, size_t>, height * fanout> stack{};
+    size_t depth = 0;
+
+    stack[depth++] = {levels.size() - 2, 0};
+
+    while (depth > 0) {
+        auto [level, index] = stack[--depth];
+
+        if (!accept(nodes[levels[level] + index])) {
+            continue;
+        }
+
+        if (level == 0) {
+            callback(order[index]);
+            continue;
+        }
+
+        auto first = index * fanout;
+        auto last  = std::min(first + fanout, count(level - 1));
+
+        for (auto child = last; child > first; --child) {
+            stack[depth++] = {level - 1, child - 1};
+        }
+    }
+}
+
+template <typename F>
+void planar::RTree::overlapping(const Bounds &region, F &&callback) const {
+    search(
+        [&region](const Bounds &node) {
+            return node.overlaps(region);
+        },
+        callback
+    );
+}
+
+template <typename F>
+void planar::RTree::containing(const Point<double> &point, F &&callback) const {
+    search(
+        [&point](const Bounds &node) {
+            return node.contains(point);
+        },
+        callback
+    );
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define PLANAR_AREAS_SIZE_HPP
 
 #include "../linear/vector.hpp"
+#include <algorithm>
 
 namespace planar {
     template <typename T>
@@ -9,35 +10,130 @@ namespace planar {
       public:
         Vector<T> size;
 
-        Size();
-        Size(T w, T h);
+        constexpr Size() noexcept;
+        constexpr Size(T w, T h) noexcept;
 
-        explicit Size(const Vector<T> &size);
+        constexpr explicit Size(const Vector<T> &size) noexcept;
 
-        bool operator==(const Size<T> &rhs) const;
-        bool operator!=(const Size<T> &rhs) const;
-        bool operator<(const Size<T> &rhs) const;
-        bool operator>(const Size<T> &rhs) const;
-        bool operator<=(const Size<T> &rhs) const;
-        bool operator>=(const Size<T> &rhs) const;
+        constexpr bool operator==(const Size<T> &rhs) const noexcept;
+        constexpr bool operator!=(const Size<T> &rhs) const noexcept;
+        constexpr bool operator<(const Size<T> &rhs) const noexcept;
+        constexpr bool operator>(const Size<T> &rhs) const noexcept;
+        constexpr bool operator<=(const Size<T> &rhs) const noexcept;
+        constexpr bool operator>=(const Size<T> &rhs) const noexcept;
 
-        Size<T> operator+(const Size<T> &rhs) const;
-        Size<T> operator-(const Size<T> &rhs) const;
-        Size<T> operator*(const T &rhs) const;
-        Size<T> operator/(const T &rhs) const;
+        constexpr Size<T> operator+(const Size<T> &rhs) const noexcept;
+        constexpr Size<T> operator-(const Size<T> &rhs) const noexcept;
+        constexpr Size<T> operator*(const T &rhs) const noexcept;
+        constexpr Size<T> operator/(const T &rhs) const noexcept;
 
         std::string repr() const;
 
-        T width() const;
-        T height() const;
+        constexpr T width() const noexcept;
+        constexpr T height() const noexcept;
 
-        bool empty() const;
+        constexpr bool empty() const noexcept;
 
-        Size<T> transpose() const;
+        constexpr Size<T> transpose() const noexcept;
 
-        Size<T> scale(T factor) const;
-        Size<T> scale(const Size<T> &factor) const;
+        constexpr Size<T> scale(T factor) const noexcept;
+        constexpr Size<T> scale(const Size<T> &factor) const noexcept;
     };
 }
 
+template <typename T>
+constexpr planar::Size<T>::Size() noexcept : size(0, 0) {
+}
+
+template <typename T>
+constexpr planar::Size<T>::Size(T w, T h) noexcept : size(w, h) {
+}
+
+template <typename T>
+constexpr planar::Size<T>::Size(const Vector<T> &size) noexcept : size(size) {
+}
+
+template <typename T>
+constexpr bool planar::Size<T>::operator==(const Size<T> &rhs) const noexcept {
+    return size == rhs.size;
+}
+
+template <typename T>
+constexpr bool planar::Size<T>::operator!=(const Size<T> &rhs) const noexcept {
+    return size != rhs.size;
+}
+
+template <typename T>
+constexpr bool planar::Size<T>::operator<(const Size<T> &rhs) const noexcept {
+    return size < rhs.size;
+}
+
+template <typename T>
+constexpr bool planar::Size<T>::operator>(const Size<T> &rhs) const noexcept {
+    return size > rhs.size;
+}
+
+template <typename T>
+constexpr bool planar::Size<T>::operator<=(const Size<T> &rhs) const noexcept {
+    return size <= rhs.size;
+}
+
+template <typename T>
+constexpr bool planar::Size<T>::operator>=(const Size<T> &rhs) const noexcept {
+    return size >= rhs.size;
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Size<T>::operator+(const Size<T> &rhs) const noexcept {
+    return Size<T>(size + rhs.size);
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Size<T>::operator-(const Size<T> &rhs) const noexcept {
+    auto difference = size - rhs.size;
+    return {std::max(difference.x, T()), std::max(difference.y, T())};
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Size<T>::operator*(const T &rhs) const noexcept {
+    auto scaled = size * rhs;
+    return {std::max(scaled.x, T()), std::max(scaled.y, T())};
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Size<T>::operator/(const T &rhs) const noexcept {
+    auto scaled = size / rhs;
+    return {std::max(scaled.x, T()), std::max(scaled.y, T())};
+}
+
+template <typename T>
+constexpr T planar::Size<T>::width() const noexcept {
+    return size.x;
+}
+
+template <typename T>
+constexpr T planar::Size<T>::height() const noexcept {
+    return size.y;
+}
+
+template <typename T>
+constexpr bool planar::Size<T>::empty() const noexcept {
+    return size.x == 0 && size.y == 0;
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Size<T>::transpose() const noexcept {
+    return {size.y, size.x};
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Size<T>::scale(T factor) const noexcept {
+    return scale({factor, factor});
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Size<T>::scale(const Size<T> &factor) const noexcept {
+    return {size.x * factor.size.x, size.y * factor.size.y};
+}
+
 #endif
@@ -1,6 +1,7 @@
 #include "size.tpp"
 #include "../linear/vector.tpp"
 #include <gtest/gtest.h>
+#include <type_traits>
 
 using namespace planar;
 
@@ -44,3 +45,11 @@ TEST(Size, Scale) {
     EXPECT_EQ(Size(1, 1).scale(2), Size(2, 2));
     EXPECT_EQ(Size(1, 1).scale({2, 3}), Size(2, 3));
 }
+
+TEST(Size, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Size<double>>);
+    static_assert(std::is_nothrow_default_constructible_v<Size<double>>);
+
+    static_assert(Size(1, 2) - Size(2, 1) == Size(0, 1));
+    static_assert(Size(1, 2).scale(3).transpose() == Size(6, 3));
+}
@@ -0,0 +1,106 @@
+#include "sweep.hpp"
+#include "../points/point.tpp"
+#include "../scalar/chunks.tpp"
+#include "bounds.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+planar::Sweep::Sweep(const std::vector<Bounds> &bounds) {
+    update(bounds);
+}
+
+size_t planar::Sweep::size() const {
+    return bounds.size();
+}
+
+void planar::Sweep::update(const std::vector<Bounds> &bounds) {
+    auto left = [&bounds](size_t a, size_t b) {
+        return bounds[a].point.x() < bounds[b].point.x();
+    };
+
+    if (bounds.size() != order.size()) {
+        order.resize(bounds.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), left);
+    } else {
+        for (size_t i = 1; i < order.size(); ++i) {
+            auto current = order[i];
+            auto j       = i;
+
+            while (j > 0 && left(current, order[j - 1])) {
+                order[j] = order[j - 1];
+                --j;
+            }
+
+            order[j] = current;
+        }
+    }
+
+    this->bounds = bounds;
+}
+
+template <typename V>
+void planar::Sweep::collect(size_t threads, V &output) const {
+    auto scan = [this](const Slice &range, auto &target) {
+        for (auto p = range.start; p < range.end; ++p) {
+            const auto &current = bounds[order[p]];
+
+            auto right  = current.point.x() + current.size.width();
+            auto top    = current.point.y();
+            auto bottom = top + current.size.height();
+
+            for (auto q = p + 1; q < order.size(); ++q) {
+                const auto &other = bounds[order[q]];
+
+                if (other.point.x() > right) {
+                    break;
+                }
+
+                if (other.point.y() <= bottom && top <= other.point.y() + other.size.height()) {
+                    target.emplace_back(std::min(order[p], order[q]), std::max(order[p], order[q]));
+                }
+            }
+        }
+    };
+
+    Chunks chunks(order.size(), threshold, threads);
+
+    if (chunks.count <= 1) {
+        chunks.run([&scan, &output](size_t, const Slice &range) {
+            scan(range, output);
+        });
+
+        return;
+    }
+
+    std::vector<std::vector<std::pair<size_t, size_t>>> found(chunks.count);
+
+    chunks.run([&scan, &found](size_t index, const Slice &range) {
+        scan(range, found[index]);
+    });
+
+    for (const auto &chunk : found) {
+        output.insert(output.end(), chunk.begin(), chunk.end());
+    }
+}
+
+std::vector<std::pair<size_t, size_t>> planar::Sweep::pairs(size_t threads) const {
+    std::vector<std::pair<size_t, size_t>> output;
+    collect(threads, output);
+    return output;
+}
+
+std::pmr::vector<std::pair<size_t, size_t>> planar::Sweep::pairs(size_t threads, std::pmr::memory_resource *resource)
+    const {
+    std::pmr::vector<std::pair<size_t, size_t>> output(resource);
+    collect(threads, output);
+    return output;
+}
+
+void planar::Sweep::pairs(size_t threads, std::vector<std::pair<size_t, size_t>> &output) const {
+    collect(threads, output);
+}
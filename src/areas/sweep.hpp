@@ -0,0 +1,35 @@
+#ifndef PLANAR_AREAS_SWEEP_HPP
+#define PLANAR_AREAS_SWEEP_HPP
+
+#include "bounds.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace planar {
+    class Sweep {
+      private:
+        std::vector<Bounds> bounds;
+        std::vector<size_t> order;
+
+        template <typename V>
+        void collect(size_t threads, V &output) const;
+
+      public:
+        static constexpr size_t threshold = 4096;
+
+        explicit Sweep(const std::vector<Bounds> &bounds = {});
+
+        size_t size() const;
+
+        void update(const std::vector<Bounds> &bounds);
+
+        std::vector<std::pair<size_t, size_t>> pairs(size_t threads = 0) const;
+        std::pmr::vector<std::pair<size_t, size_t>> pairs(size_t threads, std::pmr::memory_resource *resource) const;
+
+        void pairs(size_t threads, std::vector<std::pair<size_t, size_t>> &output) const;
+    };
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include "sweep.hpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace planar;
+
+namespace {
+    std::vector<Bounds> scatter(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<double> position(0, 100);
+        std::uniform_real_distribution<double> extent(0, 4);
+
+        std::vector<Bounds> bounds;
+
+        for (size_t i = 0; i < count; ++i) {
+            bounds.emplace_back(position(generator), position(generator), extent(generator), extent(generator));
+        }
+
+        return bounds;
+    }
+
+    std::vector<std::pair<size_t, size_t>> brute(const std::vector<Bounds> &bounds) {
+        std::vector<std::pair<size_t, size_t>> output;
+
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            for (size_t j = i + 1; j < bounds.size(); ++j) {
+                if (bounds[i].overlaps(bounds[j])) {
+                    output.emplace_back(i, j);
+                }
+            }
+        }
+
+        return output;
+    }
+
+    std::vector<std::pair<size_t, size_t>> sorted(std::vector<std::pair<size_t, size_t>> pairs) {
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+}
+
+TEST(Sweep, Cross) {
+    std::vector<Bounds> bounds({
+        {1.0, 0.0, 1.0, 4.0},
+        {0.0, 1.0, 4.0, 1.0},
+        {9.0, 9.0, 1.0, 1.0},
+    });
+
+    using Pairs = std::vector<std::pair<size_t, size_t>>;
+
+    EXPECT_EQ(Sweep(bounds).pairs(), Pairs({{0, 1}}));
+    EXPECT_EQ(Bounds::overlapping_pairs(bounds), Pairs({{0, 1}}));
+}
+
+TEST(Sweep, Pairs) {
+    auto bounds   = scatter(9000, 3);
+    auto expected = brute(bounds);
+
+    EXPECT_EQ(sorted(Sweep(bounds).pairs(1)), expected);
+    EXPECT_EQ(sorted(Sweep(bounds).pairs(4)), expected);
+}
+
+TEST(Sweep, Output) {
+    auto bounds   = scatter(9000, 7);
+    auto expected = brute(bounds);
+
+    Sweep sweep(bounds);
+
+    std::pair<size_t, size_t> marker(9, 9);
+    std::vector<std::pair<size_t, size_t>> output({marker});
+    sweep.pairs(1, output);
+
+    ASSERT_EQ(output.front(), marker);
+    EXPECT_EQ(sorted({output.begin() + 1, output.end()}), expected);
+
+    std::pmr::monotonic_buffer_resource resource;
+
+    auto pairs = sweep.pairs(4, &resource);
+    EXPECT_EQ(pairs.get_allocator().resource(), &resource);
+    EXPECT_EQ(sorted({pairs.begin(), pairs.end()}), expected);
+}
+
+TEST(Sweep, Update) {
+    auto bounds = scatter(500, 5);
+    Sweep sweep(bounds);
+
+    for (auto &item : bounds) {
+        item = item.shift({0.5, -0.25});
+    }
+
+    sweep.update(bounds);
+    EXPECT_EQ(sorted(sweep.pairs()), brute(bounds));
+
+    bounds.resize(100);
+    sweep.update(bounds);
+
+    EXPECT_EQ(sweep.size(), 100);
+    EXPECT_EQ(sorted(sweep.pairs()), brute(bounds));
+}
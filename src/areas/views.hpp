@@ -0,0 +1,96 @@
+#ifndef PLANAR_AREAS_VIEWS_HPP
+#define PLANAR_AREAS_VIEWS_HPP
+
+#include "../points/point.hpp"
+#include "bounds.hpp"
+#include "grid.hpp"
+#include "size.hpp"
+#include <cstddef>
+#include <ranges>
+
+namespace planar {
+    using Indices = std::ranges::iota_view<size_t, size_t>;
+
+    class Sampler {
+      public:
+        Point<double> origin;
+        Size<double> step;
+        size_t side;
+
+        constexpr Point<double> operator()(size_t index) const noexcept;
+    };
+
+    class Divider {
+      public:
+        Point<double> origin;
+        Size<double> segment;
+        Size<double> stride;
+
+        constexpr Bounds operator()(size_t index) const noexcept;
+    };
+
+    class Cells {
+      public:
+        Grid grid;
+
+        constexpr Bounds operator()(size_t index) const noexcept;
+    };
+
+    class SampleView : public std::ranges::transform_view<Indices, Sampler> {
+      public:
+        constexpr SampleView(const Bounds &bounds, size_t side) noexcept;
+    };
+
+    class DivisionView : public std::ranges::transform_view<Indices, Divider> {
+      public:
+        constexpr DivisionView(const Divider &divider, size_t count) noexcept;
+    };
+
+    class CellView : public std::ranges::transform_view<Indices, Cells> {
+      public:
+        constexpr explicit CellView(const Grid &grid) noexcept;
+    };
+}
+
+constexpr planar::Point<double> planar::Sampler::operator()(size_t index) const noexcept {
+    auto x = static_cast<double>(index / side);
+    auto y = static_cast<double>(index % side);
+
+    return {origin.x() + step.width() * x, origin.y() + step.height() * y};
+}
+
+constexpr planar::Bounds planar::Divider::operator()(size_t index) const noexcept {
+    auto k = static_cast<double>(index);
+
+    return {
+        {origin.x() + stride.width() * k, origin.y() + stride.height() * k},
+        segment
+    };
+}
+
+constexpr planar::Bounds planar::Cells::operator()(size_t index) const noexcept {
+    return grid.cell(index / grid.dimensions.cols, index % grid.dimensions.cols);
+}
+
+constexpr planar::SampleView::SampleView(const Bounds &bounds, size_t side) noexcept
+    : transform_view(
+          Indices(0, side * side),
+          side == 1 ? Sampler{bounds.center(), {0, 0}, side}
+                    : Sampler{
+                          bounds.point,
+                          {bounds.size.width() / static_cast<double>(side - 1),
+                           bounds.size.height() / static_cast<double>(side - 1)},
+                          side
+          }
+      ) {
+}
+
+constexpr planar::DivisionView::DivisionView(const Divider &divider, size_t count) noexcept
+    : transform_view(Indices(0, count), divider) {
+}
+
+constexpr planar::CellView::CellView(const Grid &grid) noexcept
+    : transform_view(Indices(0, grid.dimensions.rows * grid.dimensions.cols), Cells{grid}) {
+}
+
+#endif
@@ -0,0 +1,75 @@
+#include "views.hpp"
+#include "../linear/matrix.tpp"
+#include "../points/point.tpp"
+#include "bounds.hpp"
+#include "grid.hpp"
+#include <gtest/gtest.h>
+#include <ranges>
+#include <vector>
+
+using namespace planar;
+
+TEST(Views, Concepts) {
+    static_assert(std::ranges::view<SampleView>);
+    static_assert(std::ranges::view<DivisionView>);
+    static_assert(std::ranges::view<CellView>);
+
+    static_assert(std::ranges::random_access_range<SampleView>);
+    static_assert(std::ranges::random_access_range<DivisionView>);
+    static_assert(std::ranges::random_access_range<CellView>);
+
+    static_assert(std::ranges::sized_range<SampleView>);
+    static_assert(std::ranges::sized_range<DivisionView>);
+    static_assert(std::ranges::sized_range<CellView>);
+}
+
+TEST(Views, Sample) {
+    Bounds bounds(1.0, 0.0, 10.0, 10.0);
+
+    auto view = bounds.sample_view(3);
+
+    EXPECT_EQ(view.size(), 9);
+    EXPECT_EQ(view[4], Point(6.0, 5.0));
+    EXPECT_EQ(view[8], Point(11.0, 10.0));
+
+    EXPECT_EQ(bounds.sample_view(1)[0], Point(6.0, 5.0));
+    EXPECT_TRUE(bounds.sample_view(0).empty());
+}
+
+TEST(Views, Divisions) {
+    Bounds bounds(0.0, 0.0, 3.0, 6.0);
+
+    auto rows = bounds.rows_view(3);
+    auto cols = bounds.cols_view(3);
+
+    EXPECT_EQ(rows.size(), 3);
+    EXPECT_EQ(rows[2], Bounds(0.0, 4.0, 3.0, 2.0));
+
+    EXPECT_EQ(cols.size(), 3);
+    EXPECT_EQ(cols[1], Bounds(1.0, 0.0, 1.0, 6.0));
+
+    EXPECT_TRUE(bounds.rows_view(0).empty());
+}
+
+TEST(Views, Cells) {
+    Bounds bounds(0.0, 0.0, 10.0, 10.0);
+
+    auto grid = bounds.grid_view({2, 4});
+    auto tile = bounds.tile_view({2, 3}, {1.0, 1.0});
+
+    EXPECT_EQ(grid.size(), 8);
+    EXPECT_EQ(grid[6], Bounds(5.0, 5.0, 2.5, 5.0));
+
+    EXPECT_EQ(tile.size(), 6);
+    EXPECT_EQ(tile[5], Bounds(22.0, 11.0, 10.0, 10.0));
+
+    std::vector<Bounds> cells;
+
+    for (const auto &cell : bounds.grid_view({2, 2}, {1.0, 1.0}, {1.0, 1.0})) {
+        cells.push_back(cell);
+    }
+
+    auto matrix = bounds.grid({2, 2}, {1.0, 1.0}, {1.0, 1.0});
+
+    EXPECT_EQ(cells, std::vector<Bounds>(matrix.begin(), matrix.end()));
+}
@@ -0,0 +1,86 @@
+#include "matrix.tpp"
+#include "../scalar/dimensions.hpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+
+using namespace planar;
+
+namespace {
+    Matrix<double> square(size_t side) {
+        Matrix<double> output(Dimensions(side, side), 0);
+        std::iota(output.begin(), output.end(), 0.0);
+        return output;
+    }
+}
+
+void MatrixSumFunction(benchmark::State &state) {
+    auto grid = square(static_cast<size_t>(state.range(0)));
+
+    std::function<double(double, double)> add = [](double acc, double x) {
+        return acc + x;
+    };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(grid.begin(), grid.end(), 0.0, add));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void MatrixSum(benchmark::State &state) {
+    auto grid = square(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(grid.sum());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void MatrixMapFunction(benchmark::State &state) {
+    auto grid = square(static_cast<size_t>(state.range(0)));
+
+    std::function<double(const double &)> scale = [](const double &x) {
+        return x * 0.5 + 1;
+    };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(grid.map(scale));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void MatrixMap(benchmark::State &state) {
+    auto grid = square(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(grid.map([](const double &x) {
+            return x * 0.5 + 1;
+        }));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void MatrixTransform(benchmark::State &state) {
+    auto grid = square(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        grid.transform([](const double &x) {
+            return x * 0.5 + 1;
+        });
+
+        benchmark::DoNotOptimize(grid.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+BENCHMARK(MatrixSumFunction)->RangeMultiplier(4)->Range(1 << 5, 1 << 11);
+BENCHMARK(MatrixSum)->RangeMultiplier(4)->Range(1 << 5, 1 << 11);
+BENCHMARK(MatrixMapFunction)->Range(1 << 5, 1 << 10);
+BENCHMARK(MatrixMap)->Range(1 << 5, 1 << 10);
+BENCHMARK(MatrixTransform)->Range(1 << 5, 1 << 10);
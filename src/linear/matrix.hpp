@@ -1,11 +1,14 @@
 #ifndef PLANAR_LINEAR_MATRIX_HPP
 #define PLANAR_LINEAR_MATRIX_HPP
 
+#include "../scalar/dimensions.hpp"
+#include "view.hpp"
 #include <cstddef>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace planar {
-    class Dimensions;
     class Slice;
 
     template <typename T>
@@ -14,16 +17,30 @@ namespace planar {
     template <typename T>
     class Matrix {
       private:
-        std::vector<std::vector<T>> content;
+        std::vector<T> content;
+        Dimensions dimensions;
+
+        template <typename U>
+        friend class Matrix;
 
       public:
+        using iterator       = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
         explicit Matrix(const std::vector<std::vector<T>> &content = {});
 
-        Matrix(const std::vector<T> &flat, size_t size);
+        Matrix(std::vector<T> flat, size_t size);
+
+        Matrix(const Dimensions &dimensions, const T &fill);
+
+        explicit Matrix(const MatrixView<const T> &view);
 
         bool operator==(const Matrix<T> &rhs) const;
         bool operator!=(const Matrix<T> &rhs) const;
 
+        T &operator()(size_t row, size_t col);
+        const T &operator()(size_t row, size_t col) const;
+
         Dimensions size() const;
 
         bool empty() const;
@@ -32,9 +49,31 @@ namespace planar {
 
         T get(const Point<size_t> &point) const;
 
-        Matrix<T> slice(const planar::Slice &rows, const planar::Slice &cols) const;
+        std::span<T> row(size_t index);
+        std::span<const T> row(size_t index) const;
+
+        T *data();
+        const T *data() const;
+
+        iterator begin();
+        iterator end();
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        MatrixView<T> view();
+        MatrixView<const T> view() const;
+
+        MatrixView<T> slice(const planar::Slice &rows, const planar::Slice &cols);
+        MatrixView<const T> slice(const planar::Slice &rows, const planar::Slice &cols) const;
 
         T sum() const;
+
+        template <typename F>
+        auto map(F &&function) const -> Matrix<std::invoke_result_t<F &, const T &>>;
+
+        template <typename F>
+        void transform(F &&function);
     };
 }
 
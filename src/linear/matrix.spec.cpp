@@ -1,7 +1,9 @@
 #include "matrix.tpp"
 #include "../points/point.tpp"
 #include <cstddef>
+#include <funky/generics/iterables.tpp>
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include <vector>
 
 using namespace planar;
@@ -19,6 +21,15 @@ TEST(Matrix, Chunk) {
     );
 }
 
+TEST(Matrix, Fill) {
+    EXPECT_EQ(
+        Matrix<int>(Dimensions(2, 3), 1),
+        Matrix<int>({{1, 1, 1}, {1, 1, 1}})
+    );
+
+    EXPECT_TRUE(Matrix<int>(Dimensions(0, 3), 0).empty());
+}
+
 TEST(Matrix, Size) {
     EXPECT_EQ(Matrix<int>().size(), Dimensions(0, 0));
     EXPECT_EQ(Matrix<int>({{0, 0}}).size(), Dimensions(1, 2));
@@ -38,6 +49,30 @@ TEST(Matrix, Get) {
     EXPECT_EQ(grid.get({1, 1}), 3);
 }
 
+TEST(Matrix, Access) {
+    Matrix<int> grid({{0, 1}, {2, 3}});
+    EXPECT_EQ(grid(0, 1), 1);
+    EXPECT_EQ(grid(1, 0), 2);
+
+    grid(1, 0) = 4;
+    EXPECT_EQ(grid.get({0, 1}), 4);
+
+    EXPECT_THROW(grid.get({2, 0}), std::out_of_range);
+    EXPECT_THROW(grid.get({0, 2}), std::out_of_range);
+}
+
+TEST(Matrix, Row) {
+    Matrix<int> grid({{0, 1, 2}, {3, 4, 5}});
+
+    auto row = grid.row(1);
+    EXPECT_EQ(std::vector<int>(row.begin(), row.end()), std::vector<int>({3, 4, 5}));
+}
+
+TEST(Matrix, Iterate) {
+    Matrix<int> grid({{0, 1}, {2, 3}});
+    EXPECT_EQ(std::vector<int>(grid.begin(), grid.end()), std::vector<int>({0, 1, 2, 3}));
+}
+
 TEST(Matrix, Slice) {
     Matrix<int> grid({
         {0, 0, 0, 0},
@@ -47,7 +82,7 @@ TEST(Matrix, Slice) {
     });
 
     EXPECT_EQ(
-        grid.slice({0, 2}, {0, 2}), 
+        Matrix<int>(grid.slice({0, 2}, {0, 2})), 
         Matrix<int>({
             {0, 0},
             {0, 1}
@@ -55,7 +90,7 @@ TEST(Matrix, Slice) {
     );
     
     EXPECT_EQ(
-        grid.slice({0, 3}, {0, 2}), 
+        Matrix<int>(grid.slice({0, 3}, {0, 2})), 
         Matrix<int>({
             {0, 0},
             {0, 1},
@@ -64,7 +99,7 @@ TEST(Matrix, Slice) {
     );
 
     EXPECT_EQ(
-        grid.slice({0, 2}, {0, 3}),
+        Matrix<int>(grid.slice({0, 2}, {0, 3})),
         Matrix<int>({
             {0, 0, 0},
             {0, 1, 1}
@@ -72,7 +107,7 @@ TEST(Matrix, Slice) {
     );
 
     EXPECT_EQ(
-        grid.slice({1, 3}, {1, 4}),
+        Matrix<int>(grid.slice({1, 3}, {1, 4})),
         Matrix<int>({
             {1, 1, 1},
             {1, 1, 1}
@@ -90,3 +125,41 @@ TEST(Matrix, Sum) {
 
     EXPECT_EQ(grid.sum(), 24);
 }
+
+TEST(Matrix, Map) {
+    Matrix<int> grid({
+        {0, 1, 2},
+        {3, 4, 5},
+    });
+
+    EXPECT_EQ(
+        grid.map([](int x) {
+            return x * 0.5;
+        }),
+        Matrix<double>({
+            {0.0, 0.5, 1.0},
+            {1.5, 2.0, 2.5},
+        })
+    );
+
+    grid.transform([](int x) {
+        return x * x;
+    });
+
+    EXPECT_EQ(
+        grid,
+        Matrix<int>({
+            {0, 1, 4},
+            {9, 16, 25},
+        })
+    );
+
+    EXPECT_EQ(
+        Matrix<int>(Dimensions(2, 0), 0)
+            .map([](int x) {
+                return x;
+            })
+            .size(),
+        Dimensions(2, 0)
+    );
+}
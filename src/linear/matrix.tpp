@@ -6,77 +6,184 @@
 #include "../scalar/dimensions.hpp"
 #include "../scalar/slice.hpp"
 #include "matrix.hpp"
+#include "view.tpp"
+#include <algorithm>
 #include <cstddef>
-#include <funky/generics/iterables.tpp>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 template <typename T>
-planar::Matrix<T>::Matrix(const std::vector<std::vector<T>> &content) : content(content) {
+planar::Matrix<T>::Matrix(const std::vector<std::vector<T>> &content)
+    : dimensions(content.size(), content.empty() ? 0 : content[0].size()) {
+    this->content.reserve(dimensions.rows * dimensions.cols);
+
+    for (const auto &row : content) {
+        if (row.size() != dimensions.cols) {
+            throw std::invalid_argument("Matrix rows must have the same length");
+        }
+
+        this->content.insert(this->content.end(), row.begin(), row.end());
+    }
 }
 
 template <typename T>
-planar::Matrix<T>::Matrix(const std::vector<T> &flat, size_t size) {
-    size_t rows = flat.size() / size;
+planar::Matrix<T>::Matrix(std::vector<T> flat, size_t size)
+    : content(std::move(flat))
+    , dimensions(size == 0 ? 0 : content.size() / size, size) {
+    if (dimensions.rows == 0) {
+        dimensions.cols = 0;
+    }
+
+    content.resize(dimensions.rows * dimensions.cols);
+}
 
-    std::function<std::vector<T>(size_t)> chunk = [&flat, size](auto x) {
-        return funky::slice(flat, x * size, (x + 1) * size);
-    };
+template <typename T>
+planar::Matrix<T>::Matrix(const MatrixView<const T> &view) : dimensions(view.size()) {
+    content.reserve(dimensions.rows * dimensions.cols);
+    content.insert(content.end(), view.begin(), view.end());
+}
 
-    content = funky::map<std::vector<std::vector<T>>>(chunk, funky::range(rows));
+template <typename T>
+planar::Matrix<T>::Matrix(const Dimensions &dimensions, const T &fill)
+    : content(dimensions.rows * dimensions.cols, fill)
+    , dimensions(dimensions.rows, dimensions.rows == 0 ? 0 : dimensions.cols) {
 }
 
 template <typename T>
 bool planar::Matrix<T>::operator==(const Matrix<T> &rhs) const {
-    return content == rhs.content;
+    return dimensions == rhs.dimensions && content == rhs.content;
 }
 
 template <typename T>
 bool planar::Matrix<T>::operator!=(const Matrix<T> &rhs) const {
-    return content != rhs.content;
+    return !(*this == rhs);
+}
+
+template <typename T>
+T &planar::Matrix<T>::operator()(size_t row, size_t col) {
+    return content[row * dimensions.cols + col];
+}
+
+template <typename T>
+const T &planar::Matrix<T>::operator()(size_t row, size_t col) const {
+    return content[row * dimensions.cols + col];
 }
 
 template <typename T>
 planar::Dimensions planar::Matrix<T>::size() const {
-    return {content.size(), content.empty() ? 0 : content[0].size()};
+    return dimensions;
 }
 
 template <typename T>
 bool planar::Matrix<T>::empty() const {
-    return content.empty();
+    return dimensions.rows == 0;
 }
 
 template <typename T>
 void planar::Matrix<T>::clear() {
     content.clear();
+    dimensions = {0, 0};
 }
 
 template <typename T>
 T planar::Matrix<T>::get(const Point<size_t> &point) const {
-    return content.at(point.y()).at(point.x());
+    if (point.y() >= dimensions.rows || point.x() >= dimensions.cols) {
+        throw std::out_of_range("Matrix index out of range");
+    }
+
+    return (*this)(point.y(), point.x());
+}
+
+template <typename T>
+std::span<T> planar::Matrix<T>::row(size_t index) {
+    return {content.data() + index * dimensions.cols, dimensions.cols};
+}
+
+template <typename T>
+std::span<const T> planar::Matrix<T>::row(size_t index) const {
+    return {content.data() + index * dimensions.cols, dimensions.cols};
+}
+
+template <typename T>
+T *planar::Matrix<T>::data() {
+    return content.data();
+}
+
+template <typename T>
+const T *planar::Matrix<T>::data() const {
+    return content.data();
+}
+
+template <typename T>
+typename planar::Matrix<T>::iterator planar::Matrix<T>::begin() {
+    return content.begin();
+}
+
+template <typename T>
+typename planar::Matrix<T>::iterator planar::Matrix<T>::end() {
+    return content.end();
+}
+
+template <typename T>
+typename planar::Matrix<T>::const_iterator planar::Matrix<T>::begin() const {
+    return content.begin();
+}
+
+template <typename T>
+typename planar::Matrix<T>::const_iterator planar::Matrix<T>::end() const {
+    return content.end();
+}
+
+template <typename T>
+planar::MatrixView<T> planar::Matrix<T>::view() {
+    return {content.data(), dimensions};
 }
 
 template <typename T>
-planar::Matrix<T> planar::Matrix<T>::slice(const planar::Slice &rows, const planar::Slice &cols) const {
-    std::function<std::vector<T>(const std::vector<T> &)> fixed_slice = [&cols](const auto &inner) {
-        return funky::slice(inner, cols.start, cols.end);
-    };
+planar::MatrixView<const T> planar::Matrix<T>::view() const {
+    return {content.data(), dimensions};
+}
 
-    return planar::Matrix<T>(
-        funky::map<std::vector<std::vector<T>>>(fixed_slice, funky::slice(content, rows.start, rows.end))
-    );
+template <typename T>
+planar::MatrixView<T> planar::Matrix<T>::slice(const planar::Slice &rows, const planar::Slice &cols) {
+    return view().slice(rows, cols);
+}
+
+template <typename T>
+planar::MatrixView<const T> planar::Matrix<T>::slice(const planar::Slice &rows, const planar::Slice &cols) const {
+    return view().slice(rows, cols);
 }
 
 template <typename T>
 T planar::Matrix<T>::sum() const {
-    std::function<T(T, T)> add = [](auto acc, auto x) {
-        return acc + x;
-    };
+    return std::accumulate(content.begin(), content.end(), T());
+}
 
-    std::function<T(T, std::vector<T>)> sum = [&add](auto acc, auto x) {
-        return acc + funky::fold(add, T(), x);
-    };
+template <typename T>
+template <typename F>
+auto planar::Matrix<T>::map(F &&function) const -> Matrix<std::invoke_result_t<F &, const T &>> {
+    Matrix<std::invoke_result_t<F &, const T &>> output;
+
+    output.content.reserve(content.size());
+    output.dimensions = dimensions;
+
+    for (const auto &x : content) {
+        output.content.push_back(function(x));
+    }
 
-    return funky::fold(sum, T(), content);
+    return output;
+}
+
+template <typename T>
+template <typename F>
+void planar::Matrix<T>::transform(F &&function) {
+    for (auto &x : content) {
+        x = function(x);
+    }
 }
 
 #endif
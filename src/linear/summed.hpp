@@ -0,0 +1,39 @@
+#ifndef PLANAR_LINEAR_SUMMED_HPP
+#define PLANAR_LINEAR_SUMMED_HPP
+
+#include "../scalar/dimensions.hpp"
+#include "matrix.hpp"
+#include <cstddef>
+
+namespace planar {
+    class Slice;
+
+    template <typename T>
+    class SummedAreaTable {
+      private:
+        Matrix<T> values;
+        Matrix<T> table;
+        size_t dirty;
+
+        void build(size_t start, size_t threads);
+
+      public:
+        static constexpr size_t threshold = 1 << 14;
+
+        explicit SummedAreaTable(const Matrix<T> &values, size_t threads = 0);
+
+        Dimensions size() const;
+
+        bool stale() const;
+
+        T get(size_t row, size_t col) const;
+        void set(size_t row, size_t col, const T &value);
+
+        void refresh(size_t threads = 0);
+
+        T sum(const planar::Slice &rows, const planar::Slice &cols) const;
+        T sum() const;
+    };
+}
+
+#endif
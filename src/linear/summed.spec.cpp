@@ -0,0 +1,106 @@
+#include "summed.tpp"
+#include "matrix.tpp"
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+
+using namespace planar;
+
+namespace {
+    Matrix<long> random(size_t rows, size_t cols, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<long> value(-100, 100);
+
+        Matrix<long> output(Dimensions(rows, cols), 0);
+
+        for (auto &x : output) {
+            x = value(generator);
+        }
+
+        return output;
+    }
+
+    long brute(const Matrix<long> &values, const Slice &rows, const Slice &cols) {
+        long total = 0;
+
+        for (auto i = rows.start; i < rows.end; ++i) {
+            for (auto j = cols.start; j < cols.end; ++j) {
+                total += values(i, j);
+            }
+        }
+
+        return total;
+    }
+}
+
+TEST(SummedAreaTable, Sum) {
+    Matrix<int> grid({
+        {0, 1, 2, 3},
+        {0, 1, 2, 3},
+        {0, 1, 2, 3},
+        {0, 1, 2, 3},
+    });
+
+    SummedAreaTable table(grid);
+
+    EXPECT_EQ(table.sum(), 24);
+    EXPECT_EQ(table.sum({0, 1}, {0, 4}), 6);
+    EXPECT_EQ(table.sum({1, 3}, {1, 3}), 6);
+    EXPECT_EQ(table.sum({2, 2}, {0, 4}), 0);
+    EXPECT_EQ(table.sum({2, 10}, {3, 10}), 6);
+}
+
+TEST(SummedAreaTable, Random) {
+    auto values = random(67, 45, 1);
+
+    SummedAreaTable<long> sequential(values, 1);
+    SummedAreaTable<long> parallel(values, 4);
+
+    for (size_t top = 0; top < 67; top += 7) {
+        for (size_t left = 0; left < 45; left += 5) {
+            Slice rows(top, top + 13);
+            Slice cols(left, left + 9);
+
+            Slice height(top, std::min<size_t>(rows.end, 67));
+            Slice width(left, std::min<size_t>(cols.end, 45));
+
+            auto expected = brute(values, height, width);
+
+            EXPECT_EQ(sequential.sum(rows, cols), expected);
+            EXPECT_EQ(parallel.sum(rows, cols), expected);
+        }
+    }
+}
+
+TEST(SummedAreaTable, Update) {
+    auto values = random(20, 30, 2);
+
+    SummedAreaTable<long> table(values);
+
+    table.set(12, 7, 1000);
+    table.set(15, 0, -1000);
+
+    values(12, 7) = 1000;
+    values(15, 0) = -1000;
+
+    EXPECT_TRUE(table.stale());
+    EXPECT_THROW(table.sum(), std::logic_error);
+
+    table.refresh(3);
+
+    EXPECT_FALSE(table.stale());
+    EXPECT_EQ(table.get(12, 7), 1000);
+    EXPECT_EQ(table.sum(), brute(values, {0, 20}, {0, 30}));
+    EXPECT_EQ(table.sum({10, 16}, {0, 8}), brute(values, {10, 16}, {0, 8}));
+
+    EXPECT_THROW(table.set(20, 0, 1), std::out_of_range);
+}
+
+TEST(SummedAreaTable, Empty) {
+    SummedAreaTable<int> table{Matrix<int>()};
+
+    EXPECT_EQ(table.sum(), 0);
+    EXPECT_FALSE(table.stale());
+}
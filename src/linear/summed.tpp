@@ -0,0 +1,122 @@
+#ifndef PLANAR_LINEAR_SUMMED_TPP
+#define PLANAR_LINEAR_SUMMED_TPP
+
+#include "../scalar/chunks.tpp"
+#include "../scalar/dimensions.hpp"
+#include "../scalar/slice.hpp"
+#include "matrix.tpp"
+#include "summed.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+template <typename T>
+planar::SummedAreaTable<T>::SummedAreaTable(const Matrix<T> &values, size_t threads)
+    : values(values)
+    , table(Dimensions(values.size().rows + 1, values.size().cols + 1), T())
+    , dirty(values.size().rows) {
+    build(0, threads);
+}
+
+template <typename T>
+void planar::SummedAreaTable<T>::build(size_t start, size_t threads) {
+    auto [rows, cols] = values.size();
+
+    if (start >= rows || cols == 0) {
+        dirty = rows;
+        return;
+    }
+
+    auto minimum = std::max(threshold / cols, size_t{1});
+
+    Chunks lines(rows - start, minimum, threads);
+
+    lines.run([this, start, cols](size_t, const planar::Slice &range) {
+        for (auto i = start + range.start; i < start + range.end; ++i) {
+            auto source = values.row(i);
+            auto target = table.row(i + 1);
+
+            T total = T();
+
+            for (size_t j = 0; j < cols; ++j) {
+                total += source[j];
+                target[j + 1] = total;
+            }
+        }
+    });
+
+    Chunks columns(cols, std::max(threshold / (rows - start), size_t{1}), threads);
+
+    columns.run([this, start, rows](size_t, const planar::Slice &range) {
+        for (auto i = start + 1; i <= rows; ++i) {
+            auto above  = table.row(i - 1);
+            auto target = table.row(i);
+
+            for (auto j = range.start + 1; j <= range.end; ++j) {
+                target[j] += above[j];
+            }
+        }
+    });
+
+    dirty = rows;
+}
+
+template <typename T>
+planar::Dimensions planar::SummedAreaTable<T>::size() const {
+    return values.size();
+}
+
+template <typename T>
+bool planar::SummedAreaTable<T>::stale() const {
+    return dirty < values.size().rows;
+}
+
+template <typename T>
+T planar::SummedAreaTable<T>::get(size_t row, size_t col) const {
+    return values.get({col, row});
+}
+
+template <typename T>
+void planar::SummedAreaTable<T>::set(size_t row, size_t col, const T &value) {
+    auto [rows, cols] = values.size();
+
+    if (row >= rows || col >= cols) {
+        throw std::out_of_range("SummedAreaTable index out of range");
+    }
+
+    values(row, col) = value;
+    dirty            = std::min(dirty, row);
+}
+
+template <typename T>
+void planar::SummedAreaTable<T>::refresh(size_t threads) {
+    if (stale()) {
+        build(dirty, threads);
+    }
+}
+
+template <typename T>
+T planar::SummedAreaTable<T>::sum(const planar::Slice &rows, const planar::Slice &cols) const {
+    if (stale()) {
+        throw std::logic_error("SummedAreaTable must be refreshed after an update");
+    }
+
+    auto [height, width] = values.size();
+
+    auto bottom = std::min(rows.end, height);
+    auto right  = std::min(cols.end, width);
+
+    if (bottom <= rows.start || right <= cols.start) {
+        return T();
+    }
+
+    return table(bottom, right) - table(rows.start, right) - table(bottom, cols.start) + table(rows.start, cols.start);
+}
+
+template <typename T>
+T planar::SummedAreaTable<T>::sum() const {
+    auto [rows, cols] = values.size();
+    return sum({0, rows}, {0, cols});
+}
+
+#endif
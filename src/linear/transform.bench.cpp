@@ -0,0 +1,50 @@
+#include "transform.hpp"
+#include "../points/buffer.hpp"
+#include "../points/point.tpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+
+using namespace planar;
+
+namespace {
+    std::vector<Point<double>> line(size_t count) {
+        std::vector<Point<double>> points;
+        points.reserve(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            points.emplace_back(static_cast<double>(i), static_cast<double>(i % 97));
+        }
+
+        return points;
+    }
+}
+
+void TransformPoints(benchmark::State &state) {
+    auto points = line(static_cast<size_t>(state.range(0)));
+    auto viewport = Transform::translate({-50, 20}) * Transform::scale(1.5) * Transform::rotate(0.1);
+
+    std::vector<Point<double>> output(points.size());
+
+    for (auto _ : state) {
+        viewport.apply(points, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void TransformBuffer(benchmark::State &state) {
+    PointBuffer buffer(line(static_cast<size_t>(state.range(0))));
+    auto viewport = Transform::translate({-50, 20}) * Transform::scale(1.5) * Transform::rotate(0.1);
+
+    for (auto _ : state) {
+        buffer.transform(viewport);
+        benchmark::DoNotOptimize(buffer.x.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(TransformPoints)->Range(1 << 10, 1 << 20);
+BENCHMARK(TransformBuffer)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,90 @@
+#include "transform.hpp"
+#include "../areas/bounds.hpp"
+#include "../points/bezier.hpp"
+#include "../points/point.hpp"
+#include "../scalar/length.hpp"
+#include "../scalar/transformation.hpp"
+#include <cmath>
+#include <cstddef>
+#include <fmt/core.h>
+#include <span>
+#include <string>
+
+planar::Transform planar::Transform::rotate(double radians) {
+    auto cos = std::cos(radians);
+    auto sin = std::sin(radians);
+
+    return {cos, sin, -sin, cos, 0, 0};
+}
+
+planar::Transform planar::Transform::rotate(double radians, const Point<double> &origin) {
+    return translate(origin.projection()) * rotate(radians) * translate({-origin.x(), -origin.y()});
+}
+
+planar::Transform::Transform(const Transformation &transformation, const Point<double> &origin) : Transform() {
+    if (transformation.flip) {
+        *this = flip_x(origin.x());
+    }
+
+    if (transformation.rotation != 0) {
+        *this = then(rotate(transformation.rotation, origin));
+    }
+}
+
+planar::Bezier planar::Transform::operator()(const Bezier &curve) const {
+    return {(*this)(curve.p1), (*this)(curve.p2), (*this)(curve.p3), (*this)(curve.p4)};
+}
+
+std::string planar::Transform::repr() const {
+    return fmt::format("{{a: {}, b: {}, c: {}, d: {}, e: {}, f: {}}}", a, b, c, d, e, f);
+}
+
+void planar::Transform::apply(std::span<const Point<double>> points, std::span<Point<double>> output) const {
+    require(output.size(), points.size());
+
+    auto size = points.size();
+
+    const auto *source = points.data();
+    auto *target       = output.data();
+
+    for (size_t i = 0; i < size; ++i) {
+        auto x = source[i].point.x;
+        auto y = source[i].point.y;
+
+        target[i].point.x = a * x + c * y + e;
+        target[i].point.y = b * x + d * y + f;
+    }
+}
+
+void planar::Transform::apply(std::span<const Bezier> curves, std::span<Bezier> output) const {
+    require(output.size(), curves.size());
+
+    for (size_t i = 0; i < curves.size(); ++i) {
+        output[i] = (*this)(curves[i]);
+    }
+}
+
+void planar::Transform::apply(std::span<const Bounds> bounds, std::span<Bounds> output) const {
+    require(output.size(), bounds.size());
+
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        output[i] = (*this)(bounds[i]);
+    }
+}
+
+void planar::Transform::apply(std::span<double> x, std::span<double> y) const {
+    require(y.size(), x.size());
+
+    auto size = x.size();
+
+    auto *xs = x.data();
+    auto *ys = y.data();
+
+    for (size_t i = 0; i < size; ++i) {
+        auto u = xs[i];
+        auto v = ys[i];
+
+        xs[i] = a * u + c * v + e;
+        ys[i] = b * u + d * v + f;
+    }
+}
@@ -0,0 +1,161 @@
+#ifndef PLANAR_LINEAR_TRANSFORM_HPP
+#define PLANAR_LINEAR_TRANSFORM_HPP
+
+#include "../areas/bounds.hpp"
+#include "../areas/size.hpp"
+#include "../points/point.hpp"
+#include <span>
+#include <string>
+
+namespace planar {
+    class Bezier;
+    class Transformation;
+
+    class Transform {
+      public:
+        double a;
+        double b;
+        double c;
+        double d;
+        double e;
+        double f;
+
+        static constexpr Transform translate(const Size<double> &offset) noexcept;
+
+        static constexpr Transform scale(double factor) noexcept;
+        static constexpr Transform scale(const Size<double> &factor) noexcept;
+
+        static constexpr Transform flip_x(double origin = 0) noexcept;
+        static constexpr Transform flip_y(double origin = 0) noexcept;
+
+        static Transform rotate(double radians);
+        static Transform rotate(double radians, const Point<double> &origin);
+
+        constexpr Transform() noexcept;
+        constexpr Transform(double a, double b, double c, double d, double e, double f) noexcept;
+
+        explicit Transform(const Transformation &transformation, const Point<double> &origin = {0, 0});
+
+        constexpr bool operator==(const Transform &rhs) const noexcept;
+        constexpr bool operator!=(const Transform &rhs) const noexcept;
+
+        constexpr Transform operator*(const Transform &rhs) const noexcept;
+
+        constexpr Point<double> operator()(const Point<double> &point) const noexcept;
+        constexpr Bounds operator()(const Bounds &bounds) const noexcept;
+        Bezier operator()(const Bezier &curve) const;
+
+        std::string repr() const;
+
+        constexpr bool identity() const noexcept;
+
+        constexpr double determinant() const noexcept;
+
+        constexpr Transform then(const Transform &next) const noexcept;
+
+        constexpr Transform inverse() const noexcept;
+
+        void apply(std::span<const Point<double>> points, std::span<Point<double>> output) const;
+        void apply(std::span<const Bezier> curves, std::span<Bezier> output) const;
+        void apply(std::span<const Bounds> bounds, std::span<Bounds> output) const;
+
+        void apply(std::span<double> x, std::span<double> y) const;
+    };
+}
+
+constexpr planar::Transform planar::Transform::translate(const Size<double> &offset) noexcept {
+    return {1, 0, 0, 1, offset.width(), offset.height()};
+}
+
+constexpr planar::Transform planar::Transform::scale(double factor) noexcept {
+    return {factor, 0, 0, factor, 0, 0};
+}
+
+constexpr planar::Transform planar::Transform::scale(const Size<double> &factor) noexcept {
+    return {factor.width(), 0, 0, factor.height(), 0, 0};
+}
+
+constexpr planar::Transform planar::Transform::flip_x(double origin) noexcept {
+    return {-1, 0, 0, 1, 2 * origin, 0};
+}
+
+constexpr planar::Transform planar::Transform::flip_y(double origin) noexcept {
+    return {1, 0, 0, -1, 0, 2 * origin};
+}
+
+constexpr planar::Transform::Transform() noexcept : Transform(1, 0, 0, 1, 0, 0) {
+}
+
+constexpr planar::Transform::Transform(double a, double b, double c, double d, double e, double f) noexcept
+    : a(a)
+    , b(b)
+    , c(c)
+    , d(d)
+    , e(e)
+    , f(f) {
+}
+
+constexpr bool planar::Transform::operator==(const Transform &rhs) const noexcept {
+    return a == rhs.a && b == rhs.b && c == rhs.c && d == rhs.d && e == rhs.e && f == rhs.f;
+}
+
+constexpr bool planar::Transform::operator!=(const Transform &rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr planar::Transform planar::Transform::operator*(const Transform &rhs) const noexcept {
+    return {
+        a * rhs.a + c * rhs.b,
+        b * rhs.a + d * rhs.b,
+        a * rhs.c + c * rhs.d,
+        b * rhs.c + d * rhs.d,
+        a * rhs.e + c * rhs.f + e,
+        b * rhs.e + d * rhs.f + f,
+    };
+}
+
+constexpr planar::Point<double> planar::Transform::operator()(const Point<double> &point) const noexcept {
+    auto x = point.x();
+    auto y = point.y();
+
+    return {a * x + c * y + e, b * x + d * y + f};
+}
+
+constexpr planar::Bounds planar::Transform::operator()(const Bounds &bounds) const noexcept {
+    auto w = bounds.size.width() / 2;
+    auto h = bounds.size.height() / 2;
+
+    auto center = (*this)(bounds.center());
+
+    auto dx = (a < 0 ? -a : a) * w + (c < 0 ? -c : c) * h;
+    auto dy = (b < 0 ? -b : b) * w + (d < 0 ? -d : d) * h;
+
+    return {center.x() - dx, center.y() - dy, 2 * dx, 2 * dy};
+}
+
+constexpr bool planar::Transform::identity() const noexcept {
+    return *this == Transform();
+}
+
+constexpr double planar::Transform::determinant() const noexcept {
+    return a * d - b * c;
+}
+
+constexpr planar::Transform planar::Transform::then(const Transform &next) const noexcept {
+    return next * *this;
+}
+
+constexpr planar::Transform planar::Transform::inverse() const noexcept {
+    auto det = determinant();
+
+    return {
+        d / det,
+        -b / det,
+        -c / det,
+        a / det,
+        (c * f - d * e) / det,
+        (b * e - a * f) / det,
+    };
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "transform.hpp"
+#include "../areas/bounds.hpp"
+#include "../linear/vector.tpp"
+#include "../points/bezier.hpp"
+#include "../points/buffer.hpp"
+#include "../points/point.tpp"
+#include "../scalar/transformation.hpp"
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <numbers>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace planar;
+
+namespace {
+    void expect_near(const Point<double> &actual, const Point<double> &expected) {
+        EXPECT_NEAR(actual.x(), expected.x(), 1e-12);
+        EXPECT_NEAR(actual.y(), expected.y(), 1e-12);
+    }
+}
+
+TEST(Transform, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Transform>);
+
+    constexpr auto layout = Transform::translate({10, 20}) * Transform::scale(2);
+
+    static_assert(layout(Point(1.0, 1.0)) == Point(12.0, 22.0));
+    static_assert(layout.then(Transform::flip_y(5))(Point(0.0, 0.0)) == Point(10.0, -10.0));
+    static_assert((layout * layout.inverse()).identity());
+    static_assert(Transform::flip_x(1).determinant() == -1);
+}
+
+TEST(Transform, Compose) {
+    auto rotate = Transform::rotate(std::numbers::pi / 2);
+
+    expect_near(rotate(Point(1.0, 0.0)), {0.0, 1.0});
+    expect_near((Transform::translate({1, 0}) * rotate)(Point(1.0, 0.0)), {1.0, 1.0});
+    expect_near(rotate.then(Transform::translate({1, 0}))(Point(1.0, 0.0)), {1.0, 1.0});
+    expect_near(Transform::rotate(std::numbers::pi, {1.0, 1.0})(Point(2.0, 1.0)), {0.0, 1.0});
+}
+
+TEST(Transform, Transformation) {
+    EXPECT_TRUE(Transform(Transformation()).identity());
+
+    expect_near(Transform(Transformation(true))(Point(2.0, 3.0)), {-2.0, 3.0});
+    expect_near(Transform(Transformation(true), {1.0, 0.0})(Point(2.0, 3.0)), {0.0, 3.0});
+    expect_near(Transform(Transformation(true, std::numbers::pi / 2))(Point(1.0, 0.0)), {0.0, -1.0});
+}
+
+TEST(Transform, Bounds) {
+    EXPECT_EQ(Transform::translate({1, 2})(Bounds(0, 0, 3, 4)), Bounds(1, 2, 3, 4));
+    EXPECT_EQ(Transform::scale({2, 3})(Bounds(1, 1, 1, 1)), Bounds(2, 3, 2, 3));
+    EXPECT_EQ(Transform::flip_x()(Bounds(1, 1, 2, 2)), Bounds(-3, 1, 2, 2));
+
+    auto rotated = Transform::rotate(std::numbers::pi / 4)(Bounds(-1, -1, 2, 2));
+
+    EXPECT_NEAR(rotated.size.width(), 2 * std::sqrt(2), 1e-12);
+    EXPECT_NEAR(rotated.point.x(), -std::sqrt(2), 1e-12);
+}
+
+TEST(Transform, Apply) {
+    auto transform = Transform::rotate(0.3, {2, 1}).then(Transform::scale({2, 0.5}));
+
+    std::vector<Point<double>> points;
+
+    for (size_t i = 0; i < 37; ++i) {
+        points.emplace_back(static_cast<double>(i), static_cast<double>(i * i) / 7);
+    }
+
+    std::vector<Point<double>> output(points.size());
+    transform.apply(points, output);
+
+    PointBuffer buffer(points);
+    buffer.transform(transform);
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(output[i], transform(points[i]));
+        EXPECT_EQ(buffer[i], transform(points[i]));
+    }
+
+    std::vector<Bezier> curves({
+        {{0, 0}, {0, 1}, {1, 1}, {1, 0}},
+        {{2, 2}, {3, 5}, {4, 1}, {6, 2}},
+    });
+
+    std::vector<Bezier> moved(curves.size());
+    transform.apply(curves, moved);
+
+    EXPECT_EQ(moved[1].p3, transform(curves[1].p3));
+
+    std::vector<Bounds> bounds({
+        {0, 0, 1, 1},
+        {2, 3, 4, 5},
+    });
+
+    std::vector<Bounds> projected(bounds.size());
+    transform.apply(bounds, projected);
+
+    EXPECT_EQ(projected[1], transform(bounds[1]));
+
+    std::vector<Bounds> small(bounds.size() - 1);
+    EXPECT_THROW(transform.apply(bounds, small), std::length_error);
+}
+
+TEST(Transform, Repr) {
+    EXPECT_EQ(Transform().repr(), "{a: 1, b: 0, c: 0, d: 1, e: 0, f: 0}");
+}
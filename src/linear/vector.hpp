@@ -10,19 +10,19 @@ namespace planar {
         T x;
         T y;
 
-        Vector(T x, T y);
+        constexpr Vector(T x, T y) noexcept;
 
-        bool operator==(const Vector<T> &rhs) const;
-        bool operator!=(const Vector<T> &rhs) const;
-        bool operator<(const Vector<T> &rhs) const;
-        bool operator>(const Vector<T> &rhs) const;
-        bool operator<=(const Vector<T> &rhs) const;
-        bool operator>=(const Vector<T> &rhs) const;
+        constexpr bool operator==(const Vector<T> &rhs) const noexcept;
+        constexpr bool operator!=(const Vector<T> &rhs) const noexcept;
+        constexpr bool operator<(const Vector<T> &rhs) const noexcept;
+        constexpr bool operator>(const Vector<T> &rhs) const noexcept;
+        constexpr bool operator<=(const Vector<T> &rhs) const noexcept;
+        constexpr bool operator>=(const Vector<T> &rhs) const noexcept;
 
-        Vector<T> operator+(const Vector<T> &rhs) const;
-        Vector<T> operator-(const Vector<T> &rhs) const;
-        Vector<T> operator*(const T &rhs) const;
-        Vector<T> operator/(const T &rhs) const;
+        constexpr Vector<T> operator+(const Vector<T> &rhs) const noexcept;
+        constexpr Vector<T> operator-(const Vector<T> &rhs) const noexcept;
+        constexpr Vector<T> operator*(const T &rhs) const noexcept;
+        constexpr Vector<T> operator/(const T &rhs) const noexcept;
 
         std::string repr() const;
 
@@ -30,4 +30,59 @@ namespace planar {
     };
 }
 
+template <typename T>
+constexpr planar::Vector<T>::Vector(T x, T y) noexcept : x(x)
+                                                       , y(y) {
+}
+
+template <typename T>
+constexpr bool planar::Vector<T>::operator==(const Vector<T> &rhs) const noexcept {
+    return x == rhs.x && y == rhs.y;
+}
+
+template <typename T>
+constexpr bool planar::Vector<T>::operator!=(const Vector<T> &rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+template <typename T>
+constexpr bool planar::Vector<T>::operator<(const Vector<T> &rhs) const noexcept {
+    return x < rhs.x || (x == rhs.x && y < rhs.y);
+}
+
+template <typename T>
+constexpr bool planar::Vector<T>::operator>(const Vector<T> &rhs) const noexcept {
+    return rhs < *this;
+}
+
+template <typename T>
+constexpr bool planar::Vector<T>::operator<=(const Vector<T> &rhs) const noexcept {
+    return !(rhs < *this);
+}
+
+template <typename T>
+constexpr bool planar::Vector<T>::operator>=(const Vector<T> &rhs) const noexcept {
+    return !(*this < rhs);
+}
+
+template <typename T>
+constexpr planar::Vector<T> planar::Vector<T>::operator+(const Vector<T> &rhs) const noexcept {
+    return {x + rhs.x, y + rhs.y};
+}
+
+template <typename T>
+constexpr planar::Vector<T> planar::Vector<T>::operator-(const Vector<T> &rhs) const noexcept {
+    return {x - rhs.x, y - rhs.y};
+}
+
+template <typename T>
+constexpr planar::Vector<T> planar::Vector<T>::operator*(const T &rhs) const noexcept {
+    return {x * rhs, y * rhs};
+}
+
+template <typename T>
+constexpr planar::Vector<T> planar::Vector<T>::operator/(const T &rhs) const noexcept {
+    return {x / rhs, y / rhs};
+}
+
 #endif
@@ -1,5 +1,6 @@
 #include "vector.tpp"
 #include <gtest/gtest.h>
+#include <type_traits>
 
 using namespace planar;
 
@@ -26,3 +27,11 @@ TEST(Vector, Repr) {
 TEST(Vector, Magnitude) {
     EXPECT_EQ(Vector(3, 4).magnitude(), 5.0);
 }
+
+TEST(Vector, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Vector<double>>);
+    static_assert(std::is_nothrow_copy_constructible_v<Vector<double>>);
+
+    static_assert(Vector(1, 2) + Vector(3, 4) == Vector(4, 6));
+    static_assert(Vector(4, 6) / 2 < Vector(3, 0));
+}
@@ -6,61 +6,6 @@
 #include <fmt/core.h>
 #include <string>
 
-template <typename T>
-planar::Vector<T>::Vector(T x, T y) : x(x)
-                                    , y(y) {
-}
-
-template <typename T>
-bool planar::Vector<T>::operator==(const Vector<T> &rhs) const {
-    return x == rhs.x && y == rhs.y;
-}
-
-template <typename T>
-bool planar::Vector<T>::operator!=(const Vector<T> &rhs) const {
-    return !(*this == rhs);
-}
-
-template <typename T>
-bool planar::Vector<T>::operator<(const Vector<T> &rhs) const {
-    return x < rhs.x || (x == rhs.x && y < rhs.y);
-}
-
-template <typename T>
-bool planar::Vector<T>::operator>(const Vector<T> &rhs) const {
-    return rhs < *this;
-}
-
-template <typename T>
-bool planar::Vector<T>::operator<=(const Vector<T> &rhs) const {
-    return !(rhs < *this);
-}
-
-template <typename T>
-bool planar::Vector<T>::operator>=(const Vector<T> &rhs) const {
-    return !(*this < rhs);
-}
-
-template <typename T>
-planar::Vector<T> planar::Vector<T>::operator+(const Vector<T> &rhs) const {
-    return {x + rhs.x, y + rhs.y};
-}
-
-template <typename T>
-planar::Vector<T> planar::Vector<T>::operator-(const Vector<T> &rhs) const {
-    return {x - rhs.x, y - rhs.y};
-}
-
-template <typename T>
-planar::Vector<T> planar::Vector<T>::operator*(const T &rhs) const {
-    return {x * rhs, y * rhs};
-}
-
-template <typename T>
-planar::Vector<T> planar::Vector<T>::operator/(const T &rhs) const {
-    return {x / rhs, y / rhs};
-}
-
 template <typename T>
 std::string planar::Vector<T>::repr() const {
     return fmt::format("{{x: {}, y: {}}}", x, y);
@@ -0,0 +1,86 @@
+#ifndef PLANAR_LINEAR_VIEW_HPP
+#define PLANAR_LINEAR_VIEW_HPP
+
+#include "../scalar/dimensions.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace planar {
+    class Slice;
+
+    template <typename T>
+    class Point;
+
+    template <typename T>
+    class MatrixView {
+      private:
+        T *content;
+        Dimensions dimensions;
+        size_t row_stride;
+        size_t col_stride;
+
+      public:
+        using value_type = std::remove_cv_t<T>;
+
+        class iterator {
+          private:
+            T *content;
+            size_t cols;
+            size_t row_stride;
+            size_t col_stride;
+            size_t row;
+            size_t col;
+
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = std::remove_cv_t<T>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = T *;
+            using reference         = T &;
+
+            iterator();
+            iterator(const MatrixView<T> &view, size_t row, size_t col);
+
+            bool operator==(const iterator &rhs) const;
+            bool operator!=(const iterator &rhs) const;
+
+            T &operator*() const;
+
+            iterator &operator++();
+            iterator operator++(int);
+        };
+
+        MatrixView(T *content, const Dimensions &dimensions);
+        MatrixView(T *content, const Dimensions &dimensions, size_t row_stride, size_t col_stride = 1);
+
+        template <typename U>
+            requires std::is_same_v<const U, T>
+        MatrixView(const MatrixView<U> &view);
+
+        bool operator==(const MatrixView<T> &rhs) const;
+        bool operator!=(const MatrixView<T> &rhs) const;
+
+        T &operator()(size_t row, size_t col) const;
+
+        Dimensions size() const;
+
+        bool empty() const;
+
+        T *data() const;
+
+        size_t stride() const;
+        size_t step() const;
+
+        value_type get(const Point<size_t> &point) const;
+
+        iterator begin() const;
+        iterator end() const;
+
+        MatrixView<T> slice(const planar::Slice &rows, const planar::Slice &cols) const;
+
+        value_type sum() const;
+    };
+}
+
+#endif
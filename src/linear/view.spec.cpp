@@ -0,0 +1,86 @@
+#include "view.tpp"
+#include "../points/point.tpp"
+#include "matrix.tpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+using namespace planar;
+
+TEST(MatrixView, Slice) {
+    Matrix<int> grid({
+        {0, 1, 2, 3},
+        {4, 5, 6, 7},
+        {8, 9, 10, 11},
+    });
+
+    auto view = grid.slice({1, 3}, {1, 3});
+
+    EXPECT_EQ(view.size(), Dimensions(2, 2));
+    EXPECT_EQ(view.data(), grid.data() + 5);
+    EXPECT_EQ(std::vector<int>(view.begin(), view.end()), std::vector<int>({5, 6, 9, 10}));
+
+    EXPECT_TRUE(grid.slice({3, 4}, {0, 4}).empty());
+    EXPECT_TRUE(grid.slice({0, 3}, {2, 2}).empty());
+}
+
+TEST(MatrixView, Nest) {
+    Matrix<int> grid({
+        {0, 1, 2, 3},
+        {4, 5, 6, 7},
+        {8, 9, 10, 11},
+    });
+
+    auto view = grid.slice({0, 3}, {1, 4}).slice({1, 3}, {1, 2});
+
+    EXPECT_EQ(Matrix<int>(view), Matrix<int>(std::vector<std::vector<int>>({{6}, {10}})));
+    EXPECT_EQ(view.sum(), 16);
+}
+
+TEST(MatrixView, Get) {
+    Matrix<int> grid({
+        {0, 1, 2},
+        {3, 4, 5},
+    });
+
+    auto view = grid.slice({0, 2}, {1, 3});
+
+    EXPECT_EQ(view.get({0, 1}), 4);
+    EXPECT_EQ(view.get({1, 0}), 2);
+    EXPECT_THROW(view.get({2, 0}), std::out_of_range);
+}
+
+TEST(MatrixView, Write) {
+    Matrix<int> grid(Dimensions(3, 3), 0);
+
+    for (auto &x : grid.slice({1, 3}, {1, 3})) {
+        x = 1;
+    }
+
+    EXPECT_EQ(grid.sum(), 4);
+    EXPECT_EQ(grid(0, 0), 0);
+    EXPECT_EQ(grid(2, 2), 1);
+}
+
+TEST(MatrixView, External) {
+    std::array<double, 6> buffer({1, 2, 3, 4, 5, 6});
+
+    MatrixView<double> rows(buffer.data(), {2, 3});
+    MatrixView<double> transpose(buffer.data(), {3, 2}, 1, 3);
+
+    EXPECT_EQ(rows(1, 0), 4);
+    EXPECT_EQ(transpose(0, 1), 4);
+    EXPECT_EQ(transpose.sum(), 21);
+
+    EXPECT_EQ(
+        std::vector<double>(transpose.begin(), transpose.end()),
+        std::vector<double>({1, 4, 2, 5, 3, 6})
+    );
+
+    MatrixView<const double> constant = transpose;
+
+    EXPECT_EQ(constant.slice({1, 3}, {0, 1}).sum(), 5);
+    EXPECT_EQ(std::distance(constant.begin(), constant.end()), 6);
+}
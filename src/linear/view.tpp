@@ -0,0 +1,171 @@
+#ifndef PLANAR_LINEAR_VIEW_TPP
+#define PLANAR_LINEAR_VIEW_TPP
+
+#include "../points/point.hpp"
+#include "../scalar/dimensions.hpp"
+#include "../scalar/slice.hpp"
+#include "view.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+template <typename T>
+planar::MatrixView<T>::iterator::iterator()
+    : content(nullptr)
+    , cols(0)
+    , row_stride(0)
+    , col_stride(0)
+    , row(0)
+    , col(0) {
+}
+
+template <typename T>
+planar::MatrixView<T>::iterator::iterator(const MatrixView<T> &view, size_t row, size_t col)
+    : content(view.content)
+    , cols(view.dimensions.cols)
+    , row_stride(view.row_stride)
+    , col_stride(view.col_stride)
+    , row(row)
+    , col(col) {
+}
+
+template <typename T>
+bool planar::MatrixView<T>::iterator::operator==(const iterator &rhs) const {
+    return row == rhs.row && col == rhs.col;
+}
+
+template <typename T>
+bool planar::MatrixView<T>::iterator::operator!=(const iterator &rhs) const {
+    return !(*this == rhs);
+}
+
+template <typename T>
+T &planar::MatrixView<T>::iterator::operator*() const {
+    return content[row * row_stride + col * col_stride];
+}
+
+template <typename T>
+typename planar::MatrixView<T>::iterator &planar::MatrixView<T>::iterator::operator++() {
+    if (++col == cols) {
+        col = 0;
+        ++row;
+    }
+
+    return *this;
+}
+
+template <typename T>
+typename planar::MatrixView<T>::iterator planar::MatrixView<T>::iterator::operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+}
+
+template <typename T>
+planar::MatrixView<T>::MatrixView(T *content, const Dimensions &dimensions)
+    : MatrixView(content, dimensions, dimensions.cols) {
+}
+
+template <typename T>
+planar::MatrixView<T>::MatrixView(T *content, const Dimensions &dimensions, size_t row_stride, size_t col_stride)
+    : content(content)
+    , dimensions(dimensions.cols == 0 ? 0 : dimensions.rows, dimensions.rows == 0 ? 0 : dimensions.cols)
+    , row_stride(row_stride)
+    , col_stride(col_stride) {
+}
+
+template <typename T>
+template <typename U>
+    requires std::is_same_v<const U, T>
+planar::MatrixView<T>::MatrixView(const MatrixView<U> &view)
+    : MatrixView(view.data(), view.size(), view.stride(), view.step()) {
+}
+
+template <typename T>
+bool planar::MatrixView<T>::operator==(const MatrixView<T> &rhs) const {
+    return dimensions == rhs.dimensions && std::equal(begin(), end(), rhs.begin());
+}
+
+template <typename T>
+bool planar::MatrixView<T>::operator!=(const MatrixView<T> &rhs) const {
+    return !(*this == rhs);
+}
+
+template <typename T>
+T &planar::MatrixView<T>::operator()(size_t row, size_t col) const {
+    return content[row * row_stride + col * col_stride];
+}
+
+template <typename T>
+planar::Dimensions planar::MatrixView<T>::size() const {
+    return dimensions;
+}
+
+template <typename T>
+bool planar::MatrixView<T>::empty() const {
+    return dimensions.rows == 0;
+}
+
+template <typename T>
+T *planar::MatrixView<T>::data() const {
+    return content;
+}
+
+template <typename T>
+size_t planar::MatrixView<T>::stride() const {
+    return row_stride;
+}
+
+template <typename T>
+size_t planar::MatrixView<T>::step() const {
+    return col_stride;
+}
+
+template <typename T>
+typename planar::MatrixView<T>::value_type planar::MatrixView<T>::get(const Point<size_t> &point) const {
+    if (point.y() >= dimensions.rows || point.x() >= dimensions.cols) {
+        throw std::out_of_range("MatrixView index out of range");
+    }
+
+    return (*this)(point.y(), point.x());
+}
+
+template <typename T>
+typename planar::MatrixView<T>::iterator planar::MatrixView<T>::begin() const {
+    return {*this, 0, 0};
+}
+
+template <typename T>
+typename planar::MatrixView<T>::iterator planar::MatrixView<T>::end() const {
+    return {*this, dimensions.rows, 0};
+}
+
+template <typename T>
+planar::MatrixView<T> planar::MatrixView<T>::slice(const planar::Slice &rows, const planar::Slice &cols) const {
+    auto row_end = std::min(rows.end, dimensions.rows);
+    auto col_end = std::min(cols.end, dimensions.cols);
+
+    auto height = row_end > rows.start ? row_end - rows.start : 0;
+    auto width  = col_end > cols.start ? col_end - cols.start : 0;
+
+    if (height == 0 || width == 0) {
+        return {content, {0, 0}, row_stride, col_stride};
+    }
+
+    return {&(*this)(rows.start, cols.start), {height, width}, row_stride, col_stride};
+}
+
+template <typename T>
+typename planar::MatrixView<T>::value_type planar::MatrixView<T>::sum() const {
+    value_type total = value_type();
+
+    for (size_t i = 0; i < dimensions.rows; ++i) {
+        for (size_t j = 0; j < dimensions.cols; ++j) {
+            total += (*this)(i, j);
+        }
+    }
+
+    return total;
+}
+
+#endif
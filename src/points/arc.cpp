@@ -0,0 +1,73 @@
+#include "arc.hpp"
+#include "bezier.hpp"
+#include "point.tpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+planar::Arc::Arc(const Bezier &curve, size_t resolution)
+    : curve(curve)
+    , lengths(std::max(resolution, size_t{1}) + 1, 0) {
+    auto step = 1 / static_cast<double>(lengths.size() - 1);
+
+    for (size_t i = 1; i < lengths.size(); ++i) {
+        auto start = step * static_cast<double>(i - 1);
+        lengths[i] = lengths[i - 1] + curve.length(start, start + step);
+    }
+}
+
+size_t planar::Arc::resolution() const {
+    return lengths.size() - 1;
+}
+
+double planar::Arc::length() const {
+    return lengths.back();
+}
+
+double planar::Arc::parameter(double distance) const {
+    if (!(distance > 0)) {
+        return 0;
+    }
+
+    if (distance >= length()) {
+        return 1;
+    }
+
+    auto upper = static_cast<size_t>(std::upper_bound(lengths.begin(), lengths.end(), distance) - lengths.begin());
+    auto lower = upper - 1;
+
+    auto span  = lengths[upper] - lengths[lower];
+    auto ratio = span == 0 ? 0 : (distance - lengths[lower]) / span;
+
+    return (static_cast<double>(lower) + ratio) / static_cast<double>(resolution());
+}
+
+planar::Point<double> planar::Arc::point(double distance) const {
+    return curve.point(parameter(distance));
+}
+
+void planar::Arc::spaced(std::span<Point<double>> output) const {
+    if (output.empty()) {
+        return;
+    }
+
+    if (output.size() == 1) {
+        output[0] = curve.point(0);
+        return;
+    }
+
+    auto step = length() / static_cast<double>(output.size() - 1);
+
+    std::array<double, 64> ts{};
+
+    for (size_t start = 0; start < output.size(); start += ts.size()) {
+        auto size = std::min(ts.size(), output.size() - start);
+
+        for (size_t i = 0; i < size; ++i) {
+            ts[i] = parameter(step * static_cast<double>(start + i));
+        }
+
+        curve.points(std::span(ts).first(size), output.subspan(start, size));
+    }
+}
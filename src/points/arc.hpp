@@ -0,0 +1,33 @@
+#ifndef PLANAR_POINTS_ARC_HPP
+#define PLANAR_POINTS_ARC_HPP
+
+#include "bezier.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace planar {
+    template <typename T>
+    class Point;
+
+    class Arc {
+      private:
+        Bezier curve;
+        std::vector<double> lengths;
+
+      public:
+        explicit Arc(const Bezier &curve, size_t resolution = 32);
+
+        size_t resolution() const;
+
+        double length() const;
+
+        double parameter(double distance) const;
+
+        Point<double> point(double distance) const;
+
+        void spaced(std::span<Point<double>> output) const;
+    };
+}
+
+#endif
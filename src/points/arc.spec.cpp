@@ -0,0 +1,44 @@
+#include "arc.hpp"
+#include "../linear/vector.tpp"
+#include "bezier.hpp"
+#include "point.tpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace planar;
+
+TEST(Arc, Length) {
+    EXPECT_NEAR(Arc(Bezier({0, 0}, {1, 0}, {2, 0}, {3, 0})).length(), 3, 1e-9);
+    EXPECT_NEAR(Arc(Bezier({0, 0}, {1, 1}, {2, 2}, {3, 3})).length(), 3 * std::sqrt(2), 1e-9);
+
+    Bezier bezier({0, 0}, {0, 1}, {1, 1}, {1, 0});
+    EXPECT_NEAR(Arc(bezier).length(), bezier.length(), 1e-4);
+    EXPECT_NEAR(Arc(bezier).length(), 2, 0.01);
+}
+
+TEST(Arc, Parameter) {
+    Arc arc(Bezier({0, 0}, {1, 0}, {2, 0}, {3, 0}));
+
+    EXPECT_EQ(arc.parameter(-1), 0);
+    EXPECT_EQ(arc.parameter(4), 1);
+
+    EXPECT_NEAR(arc.parameter(1.5), 0.5, 1e-9);
+    EXPECT_NEAR(arc.point(1).x(), 1, 1e-9);
+}
+
+TEST(Arc, Spaced) {
+    Bezier bezier({0, 0}, {0, 1}, {1, 1}, {1, 0});
+    Arc arc(bezier, 64);
+
+    std::vector<Point<double>> points(11);
+    arc.spaced(points);
+
+    EXPECT_NEAR(points.front().x(), 0, 1e-9);
+    EXPECT_NEAR(points.back().x(), 1, 1e-9);
+
+    for (size_t i = 1; i < points.size(); ++i) {
+        auto distance = (points[i].point - points[i - 1].point).magnitude();
+        EXPECT_NEAR(distance, arc.length() / 10, 0.005);
+    }
+}
@@ -0,0 +1,123 @@
+#include "bezier.tpp"
+#include "../areas/bounds.hpp"
+#include "../areas/views.hpp"
+#include "../linear/matrix.tpp"
+#include "point.tpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+using namespace planar;
+
+namespace {
+    std::vector<Bezier> curves(size_t count) {
+        std::vector<Bezier> output;
+        output.reserve(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto x = static_cast<double>(i);
+            output.emplace_back(Point(x, 0.0), Point(x + 1, 2.0), Point(x + 2, -2.0), Point(x + 3, 0.0));
+        }
+
+        return output;
+    }
+
+    std::vector<Point<double>> wave(size_t count) {
+        std::vector<Point<double>> output;
+        output.reserve(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto x = static_cast<double>(i) / static_cast<double>(count);
+            output.emplace_back(x, std::sin(3 * x));
+        }
+
+        return output;
+    }
+}
+
+void BezierTransformFunction(benchmark::State &state) {
+    auto input = curves(static_cast<size_t>(state.range(0)));
+
+    std::function<Point<double>(const Point<double> &)> map = [](const Point<double> &point) {
+        return point.flip_y(0).shift({1, 1});
+    };
+
+    for (auto _ : state) {
+        for (auto &curve : input) {
+            curve = curve.transform(map);
+        }
+
+        benchmark::DoNotOptimize(input.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BezierTransform(benchmark::State &state) {
+    auto input = curves(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (auto &curve : input) {
+            curve = curve.transform([](const Point<double> &point) {
+                return point.flip_y(0).shift({1, 1});
+            });
+        }
+
+        benchmark::DoNotOptimize(input.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BezierFit(benchmark::State &state) {
+    auto points = wave(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Bezier curve;
+        benchmark::DoNotOptimize(curve.fit(points));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BoundsGrid(benchmark::State &state) {
+    auto side = static_cast<size_t>(state.range(0));
+    Bounds page(0, 0, 1000, 1000);
+
+    for (auto _ : state) {
+        Size<double> total;
+
+        for (const auto &cell : page.grid({side, side}, {1, 1}, {2, 2})) {
+            total = total + cell.size;
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void BoundsGridView(benchmark::State &state) {
+    auto side = static_cast<size_t>(state.range(0));
+    Bounds page(0, 0, 1000, 1000);
+
+    for (auto _ : state) {
+        Size<double> total;
+
+        for (const auto &cell : page.grid_view({side, side}, {1, 1}, {2, 2})) {
+            total = total + cell.size;
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+BENCHMARK(BezierTransformFunction)->Range(1 << 10, 1 << 16);
+BENCHMARK(BezierTransform)->Range(1 << 10, 1 << 16);
+BENCHMARK(BezierFit)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK(BoundsGrid)->RangeMultiplier(4)->Range(1 << 3, 1 << 11);
+BENCHMARK(BoundsGridView)->RangeMultiplier(4)->Range(1 << 3, 1 << 11);
@@ -2,10 +2,493 @@
 #include "../areas/bounds.hpp"
 #include "../areas/size.tpp"
 #include "../linear/vector.tpp"
+#include "../scalar/instrument.hpp"
+#include "../scalar/length.hpp"
 #include "point.tpp"
+#include "segment.tpp"
+#include "series.hpp"
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <fmt/core.h>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr std::array<std::array<double, 2>, 4> quadrature{{
+        {0.1834346424956498, 0.3626837833783620},
+        {0.5255324099163290, 0.3137066458778873},
+        {0.7966664774136267, 0.2223810344533745},
+        {0.9602898564975363, 0.1012285362903763},
+    }};
+
+    std::array<double, 4> bernstein(double t) {
+        auto s = 1 - t;
+        return {s * s * s, 3 * s * s * t, 3 * s * t * t, t * t * t};
+    }
+
+    template <typename F>
+    void evaluate(
+        const std::array<planar::Vector<double>, 4> &power,
+        size_t size,
+        F &&parameter,
+        planar::Point<double> *output
+    ) {
+        const auto &[a, b, c, d] = power;
+
+        for (size_t i = 0; i < size; ++i) {
+            auto t = parameter(i);
+
+            output[i] = planar::Point<double>(
+                ((a.x * t + b.x) * t + c.x) * t + d.x,
+                ((a.y * t + b.y) * t + c.y) * t + d.y
+            );
+        }
+    }
+
+    std::pair<double, double> extrema(double q1, double q2, double q3, double q4) {
+        auto low  = std::min(q1, q4);
+        auto high = std::max(q1, q4);
+
+        auto a = -q1 + 3 * q2 - 3 * q3 + q4;
+        auto b = 2 * (q1 - 2 * q2 + q3);
+        auto c = q2 - q1;
+
+        auto include = [&](double t) {
+            if (t > 0 && t < 1) {
+                auto s     = 1 - t;
+                auto value = s * s * s * q1 + 3 * s * s * t * q2 + 3 * s * t * t * q3 + t * t * t * q4;
+
+                low  = std::min(low, value);
+                high = std::max(high, value);
+            }
+        };
+
+        if (std::abs(a) < 1e-12) {
+            if (b != 0) {
+                include(-c / b);
+            }
+
+            return {low, high};
+        }
+
+        auto discriminant = b * b - 4 * a * c;
+
+        if (discriminant >= 0) {
+            auto root = std::sqrt(discriminant);
+
+            include((-b + root) / (2 * a));
+            include((-b - root) / (2 * a));
+        }
+
+        return {low, high};
+    }
+
+    class Candidate {
+      public:
+        planar::Bezier a;
+        planar::Bezier b;
+
+        double a0;
+        double a1;
+        double b0;
+        double b1;
+    };
+
+    double extent(const planar::Bounds &bounds) {
+        return std::max(bounds.size.width(), bounds.size.height());
+    }
+
+    double magnitude(const planar::Bounds &bounds) {
+        return std::max({
+            std::abs(bounds.point.x()),
+            std::abs(bounds.point.y()),
+            std::abs(bounds.point.x() + bounds.size.width()),
+            std::abs(bounds.point.y() + bounds.size.height()),
+        });
+    }
+
+    double offset(
+        const planar::Point<double> &start,
+        const planar::Point<double> &end,
+        const planar::Point<double> &point
+    ) {
+        auto dx = end.x() - start.x();
+        auto dy = end.y() - start.y();
+
+        auto length = std::hypot(dx, dy);
+
+        if (length == 0) {
+            return std::hypot(point.x() - start.x(), point.y() - start.y());
+        }
+
+        return std::abs(dx * (point.y() - start.y()) - dy * (point.x() - start.x())) / length;
+    }
+
+    bool flat(const planar::Bezier &curve, double tolerance) {
+        return offset(curve.p1, curve.p4, curve.p2) <= tolerance && offset(curve.p1, curve.p4, curve.p3) <= tolerance;
+    }
+
+    double refine(const planar::Bezier &curve, const planar::Point<double> &point, double t) {
+        for (size_t i = 0; i < 8; ++i) {
+            auto delta = curve.point(t).point - point.point;
+            auto slope = curve.derivative(t);
+
+            auto denominator = slope.x * slope.x + slope.y * slope.y;
+
+            if (denominator == 0) {
+                break;
+            }
+
+            t = std::clamp(t - (delta.x * slope.x + delta.y * slope.y) / denominator, 0.0, 1.0);
+        }
+
+        return t;
+    }
+
+    double locate(const planar::Bezier &curve, const planar::Point<double> &point) {
+        auto dx = curve.p4.x() - curve.p1.x();
+        auto dy = curve.p4.y() - curve.p1.y();
+
+        auto length = dx * dx + dy * dy;
+
+        auto projection = (point.x() - curve.p1.x()) * dx + (point.y() - curve.p1.y()) * dy;
+        auto guess      = length == 0 ? 0 : std::clamp(projection / length, 0.0, 1.0);
+
+        auto best     = refine(curve, point, guess);
+        auto distance = (curve.point(best).point - point.point).magnitude();
+
+        for (auto start : {0.0, 0.25, 0.5, 0.75, 1.0}) {
+            auto t = refine(curve, point, start);
+            auto d = (curve.point(t).point - point.point).magnitude();
+
+            if (d < distance) {
+                best     = t;
+                distance = d;
+            }
+        }
+
+        return best;
+    }
+
+    bool matches(const planar::Bezier &lhs, const planar::Bezier &rhs, double tolerance) {
+        return (lhs.p1.point - rhs.p1.point).magnitude() <= tolerance &&
+               (lhs.p2.point - rhs.p2.point).magnitude() <= tolerance &&
+               (lhs.p3.point - rhs.p3.point).magnitude() <= tolerance &&
+               (lhs.p4.point - rhs.p4.point).magnitude() <= tolerance;
+    }
+
+    std::optional<std::array<double, 4>> collinear(const Candidate &candidate, double tolerance) {
+        const auto &[a, b, a0, a1, b0, b1] = candidate;
+
+        if (!flat(a, tolerance) || !flat(b, tolerance) || offset(a.p1, a.p4, b.p1) > tolerance ||
+            offset(a.p1, a.p4, b.p4) > tolerance) {
+            return std::nullopt;
+        }
+
+        auto first = locate(a, b.p1);
+        auto last  = locate(a, b.p4);
+
+        auto start = std::min(first, last);
+        auto end   = std::max(first, last);
+
+        auto u_start = locate(b, a.point(start));
+        auto u_end   = locate(b, a.point(end));
+
+        return std::array<double, 4>{
+            a0 + start * (a1 - a0),
+            b0 + u_start * (b1 - b0),
+            a0 + end * (a1 - a0),
+            b0 + u_end * (b1 - b0),
+        };
+    }
+
+    std::optional<std::array<double, 4>> coincident(const Candidate &candidate, double tolerance) {
+        const auto &[a, b, a0, a1, b0, b1] = candidate;
+
+        std::array<std::pair<double, double>, 4> ends;
+        size_t count = 0;
+
+        auto on = [tolerance](const planar::Bezier &curve, const planar::Point<double> &point, double &t) {
+            if (!curve.hull().pad({-2 * tolerance, -2 * tolerance}).contains(point)) {
+                return false;
+            }
+
+            t = locate(curve, point);
+            return (curve.point(t).point - point.point).magnitude() <= tolerance;
+        };
+
+        double t = 0;
+
+        if (on(a, b.p1, t)) {
+            ends[count++] = {t, 0};
+        }
+
+        if (on(a, b.p4, t)) {
+            ends[count++] = {t, 1};
+        }
+
+        if (on(b, a.p1, t)) {
+            ends[count++] = {0, t};
+        }
+
+        if (on(b, a.p4, t)) {
+            ends[count++] = {1, t};
+        }
+
+        if (count < 2) {
+            return std::nullopt;
+        }
+
+        auto [low, high] = std::minmax_element(ends.begin(), ends.begin() + static_cast<std::ptrdiff_t>(count));
+
+        auto [t0, u0] = *low;
+        auto [t1, u1] = *high;
+
+        if (t1 <= t0) {
+            return std::nullopt;
+        }
+
+        auto piece = a.subcurve(t0, t1);
+        auto other = b.subcurve(std::min(u0, u1), std::max(u0, u1));
+
+        if (u1 < u0) {
+            other = planar::Bezier(other.p4, other.p3, other.p2, other.p1);
+        }
+
+        if (!matches(piece, other, tolerance)) {
+            return std::nullopt;
+        }
+
+        return std::array<double, 4>{
+            a0 + t0 * (a1 - a0),
+            b0 + u0 * (b1 - b0),
+            a0 + t1 * (a1 - a0),
+            b0 + u1 * (b1 - b0),
+        };
+    }
+
+    template <typename T, typename V>
+    auto scratch(const V &output) {
+        using A = typename std::allocator_traits<typename V::allocator_type>::template rebind_alloc<T>;
+        return std::vector<T, A>(A(output.get_allocator()));
+    }
+
+    template <typename S, typename H, typename O>
+    void intersect(
+        const planar::Bezier &a,
+        const planar::Bezier &b,
+        double tolerance,
+        S &stack,
+        H &hits,
+        H &spans,
+        O &output
+    ) {
+        hits.clear();
+        spans.clear();
+        stack.clear();
+
+        auto scale = std::max(magnitude(a.hull()), magnitude(b.hull()));
+        tolerance  = std::max(tolerance, scale * std::numeric_limits<double>::epsilon() * 16);
+
+        Candidate root{a, b, 0, 1, 0, 1};
+
+        if (auto span = coincident(root, tolerance)) {
+            spans.push_back(*span);
+        } else {
+            stack.push_back(root);
+        }
+
+        for (size_t iteration = 0; !stack.empty() && iteration < planar::Bezier::max_iterations; ++iteration) {
+            auto candidate = stack.back();
+            stack.pop_back();
+
+            auto left  = candidate.a.hull();
+            auto right = candidate.b.hull();
+
+            if (!left.overlaps(right)) {
+                continue;
+            }
+
+            auto split_a = extent(left) >= extent(right);
+
+            if (std::max(extent(left), extent(right)) <= tolerance) {
+                hits.push_back({candidate.a0, candidate.a1, candidate.b0, candidate.b1});
+                continue;
+            }
+
+            if (auto span = collinear(candidate, tolerance)) {
+                auto length = (a.point((*span)[2]).point - a.point((*span)[0]).point).magnitude();
+
+                if (length > 4 * tolerance) {
+                    spans.push_back(*span);
+                } else {
+                    hits.push_back({candidate.a0, candidate.a1, candidate.b0, candidate.b1});
+                }
+
+                continue;
+            }
+
+            if (split_a) {
+                auto [first, second] = candidate.a.split(0.5);
+                auto middle          = (candidate.a0 + candidate.a1) / 2;
+
+                stack.push_back({second, candidate.b, middle, candidate.a1, candidate.b0, candidate.b1});
+                stack.push_back({first, candidate.b, candidate.a0, middle, candidate.b0, candidate.b1});
+            } else {
+                auto [first, second] = candidate.b.split(0.5);
+                auto middle          = (candidate.b0 + candidate.b1) / 2;
+
+                stack.push_back({candidate.a, second, candidate.a0, candidate.a1, middle, candidate.b1});
+                stack.push_back({candidate.a, first, candidate.a0, candidate.a1, candidate.b0, middle});
+            }
+        }
+
+        std::sort(spans.begin(), spans.end());
+
+        size_t merged = 0;
+
+        for (const auto &span : spans) {
+            if (merged > 0) {
+                auto &last = spans[merged - 1];
+
+                auto gap = (a.point(span[0]).point - a.point(last[2]).point).magnitude();
+
+                if (span[0] <= last[2] || gap <= 4 * tolerance) {
+                    if (span[2] > last[2]) {
+                        last[2] = span[2];
+                        last[3] = span[3];
+                    }
+
+                    continue;
+                }
+            }
+
+            spans[merged++] = span;
+        }
+
+        spans.resize(merged);
+
+        auto covered = [&a, &spans, tolerance](double t) {
+            return std::ranges::any_of(spans, [&a, t, tolerance](const auto &span) {
+                return (span[0] <= t && t <= span[2]) ||
+                       (a.point(t).point - a.point(span[0]).point).magnitude() <= 4 * tolerance ||
+                       (a.point(t).point - a.point(span[2]).point).magnitude() <= 4 * tolerance;
+            });
+        };
+
+        auto first = output.size();
+
+        for (const auto &span : spans) {
+            output.emplace_back(span[0], span[1]);
+            output.emplace_back(span[2], span[3]);
+        }
+
+        std::sort(hits.begin(), hits.end());
+
+        for (size_t i = 0; i < hits.size();) {
+            auto cluster = hits[i];
+
+            for (++i; i < hits.size(); ++i) {
+                const auto &[t0, t1, u0, u1] = hits[i];
+
+                auto slack_t = t1 - t0;
+                auto slack_u = u1 - u0;
+
+                if (t0 > cluster[1] + slack_t || u0 > cluster[3] + slack_u || u1 < cluster[2] - slack_u) {
+                    break;
+                }
+
+                cluster = {cluster[0], std::max(cluster[1], t1), std::min(cluster[2], u0), std::max(cluster[3], u1)};
+            }
+
+            auto t = (cluster[0] + cluster[1]) / 2;
+
+            if (!covered(t)) {
+                output.emplace_back(t, (cluster[2] + cluster[3]) / 2);
+            }
+        }
+
+        std::sort(output.begin() + static_cast<std::ptrdiff_t>(first), output.end());
+    }
+
+    template <typename O>
+    void intersect(const planar::Bezier &curve, std::span<const planar::Bezier> others, double tolerance, O &output) {
+        auto stack = scratch<Candidate>(output);
+        auto hits  = scratch<std::array<double, 4>>(output);
+        auto spans = scratch<std::array<double, 4>>(output);
+        auto pairs = scratch<std::pair<double, double>>(output);
+
+        auto bounds = curve.hull();
+
+        for (size_t i = 0; i < others.size(); ++i) {
+            if (!bounds.overlaps(others[i].hull())) {
+                continue;
+            }
+
+            pairs.clear();
+            intersect(curve, others[i], tolerance, stack, hits, spans, pairs);
+
+            for (const auto &[t, u] : pairs) {
+                output.emplace_back(i, t, u);
+            }
+        }
+    }
+
+    planar::Bezier line(const planar::Segment<double> &segment) {
+        auto direction = segment.end.point - segment.start.point;
+        return {segment.start, segment.start + direction / 3, segment.start + direction * 2 / 3, segment.end};
+    }
+
+    std::pmr::vector<double> parameterize(
+        const std::vector<planar::Point<double>> &points,
+        planar::Parameterization parameterization
+    ) {
+        std::pmr::vector<double> params(points.size(), 0, planar::Instrument::resource());
+
+        auto span = points.back().x() - points.front().x();
+
+        if (parameterization == planar::Parameterization::Horizontal && span != 0) {
+            for (size_t i = 0; i < points.size(); ++i) {
+                params[i] = std::clamp((points[i].x() - points.front().x()) / span, 0.0, 1.0);
+            }
+
+            return params;
+        }
+
+        for (size_t i = 1; i < points.size(); ++i) {
+            params[i] = params[i - 1] + (points[i].point - points[i - 1].point).magnitude();
+        }
+
+        auto total = params.back();
+        auto steps = static_cast<double>(points.size() - 1);
+
+        for (size_t i = 0; i < points.size(); ++i) {
+            params[i] = total == 0 ? static_cast<double>(i) / steps : params[i] / total;
+        }
+
+        return params;
+    }
+}
+
+planar::Intersection::Intersection(size_t index, double t, double u) : index(index), t(t), u(u) {
+}
+
+bool planar::Intersection::operator==(const Intersection &rhs) const {
+    return index == rhs.index && t == rhs.t && u == rhs.u;
+}
+
+bool planar::Intersection::operator!=(const Intersection &rhs) const {
+    return !(*this == rhs);
+}
+
+planar::Bezier::Bezier() = default;
 
 planar::Bezier::Bezier(
     const planar::Point<double> &p1,
@@ -20,52 +503,96 @@ planar::Bezier::Bezier(
 }
 
 planar::Bezier::Bezier(const std::vector<Point<double>> &points) {
+    fit(points);
+}
+
+bool planar::Bezier::operator==(const Bezier &rhs) const {
+    return p1 == rhs.p1 && p2 == rhs.p2 && p3 == rhs.p3 && p4 == rhs.p4;
+}
+
+bool planar::Bezier::operator!=(const Bezier &rhs) const {
+    return !(*this == rhs);
+}
+
+std::string planar::Bezier::repr() const {
+    return fmt::format("[{}, {}, {}, {}]", p1.repr(), p2.repr(), p3.repr(), p4.repr());
+}
+
+double planar::Bezier::fit(
+    const std::vector<Point<double>> &points,
+    Parameterization parameterization,
+    size_t iterations
+) {
+    PLANAR_MEASURE("Bezier::fit");
+    PLANAR_COUNT(points.size());
+
     if (points.size() < 2) {
-        return;
+        return 0;
     }
 
     p1 = points.front();
     p4 = points.back();
 
-    p2 = p1;
-    p3 = p4;
+    auto params = parameterize(points, parameterization);
+
+    for (size_t iteration = 0; iteration <= iterations; ++iteration) {
+        if (iteration > 0) {
+            for (size_t i = 0; i < points.size(); ++i) {
+                auto t = params[i];
+
+                auto delta  = point(t).point - points[i].point;
+                auto first  = derivative(t);
+                auto second = second_derivative(t);
+
+                auto numerator   = delta.x * first.x + delta.y * first.y;
+                auto denominator = first.x * first.x + first.y * first.y + delta.x * second.x + delta.y * second.y;
+
+                if (denominator != 0) {
+                    params[i] = std::clamp(t - numerator / denominator, 0.0, 1.0);
+                }
+            }
+        }
+
+        double c11 = 0;
+        double c12 = 0;
+        double c22 = 0;
 
-    auto grid  = Bounds::enclose(points).scale({1, 1.5}).sample(5);
-    auto error = square_error(points);
+        Vector<double> r1(0, 0);
+        Vector<double> r2(0, 0);
 
-    auto best_p2    = p1;
-    auto best_p3    = p4;
-    auto best_error = error;
+        for (size_t i = 0; i < points.size(); ++i) {
+            auto [b0, b1, b2, b3] = bernstein(params[i]);
 
-    for (const auto &i : grid) {
-        for (const auto &j : grid) {
-            p2 = i;
-            p3 = j;
+            auto residual = points[i].point - p1.point * b0 - p4.point * b3;
 
-            auto current_error = square_error(points);
+            c11 += b1 * b1;
+            c12 += b1 * b2;
+            c22 += b2 * b2;
 
-            if (current_error < best_error) {
-                best_p2    = p2;
-                best_p3    = p3;
-                best_error = current_error;
-            };
+            r1 = r1 + residual * b1;
+            r2 = r2 + residual * b2;
         }
-    }
 
-    p2 = best_p2;
-    p3 = best_p3;
-}
+        auto determinant = c11 * c22 - c12 * c12;
 
-bool planar::Bezier::operator==(const Bezier &rhs) const {
-    return p1 == rhs.p1 && p2 == rhs.p2 && p3 == rhs.p3 && p4 == rhs.p4;
-}
+        if (determinant <= 1e-12 * c11 * c22) {
+            p2 = p1;
+            p3 = p4;
+            break;
+        }
 
-bool planar::Bezier::operator!=(const Bezier &rhs) const {
-    return !(*this == rhs);
-}
+        p2 = Point<double>((r1 * c22 - r2 * c12) / determinant);
+        p3 = Point<double>((r2 * c11 - r1 * c12) / determinant);
+    }
 
-std::string planar::Bezier::repr() const {
-    return fmt::format("[{}, {}, {}, {}]", p1.repr(), p2.repr(), p3.repr(), p4.repr());
+    double error = 0;
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        auto delta = point(params[i]).point - points[i].point;
+        error += delta.x * delta.x + delta.y * delta.y;
+    }
+
+    return error;
 }
 
 planar::Point<double> planar::Bezier::point(double t) const {
@@ -83,39 +610,284 @@ planar::Point<double> planar::Bezier::point(double t) const {
     };
 }
 
-planar::Bezier planar::Bezier::shift(const planar::Size<double> &offset) const {
+void planar::Bezier::points(std::span<const double> ts, std::span<Point<double>> output) const {
+    require(output.size(), ts.size());
+
+    const auto *data = ts.data();
+
+    evaluate(
+        coefficients(),
+        ts.size(),
+        [data](size_t i) {
+            return data[i];
+        },
+        output.data()
+    );
+}
+
+void planar::Bezier::points(double start, double step, std::span<Point<double>> output) const {
+    evaluate(
+        coefficients(),
+        output.size(),
+        [start, step](size_t i) {
+            return start + step * static_cast<double>(i);
+        },
+        output.data()
+    );
+}
+
+std::array<planar::Vector<double>, 4> planar::Bezier::coefficients() const {
     return {
-        p1 + offset,
-        p2 + offset,
-        p3 + offset,
-        p4 + offset,
+        p4.point - p1.point + (p2.point - p3.point) * 3,
+        (p1.point - p2.point * 2 + p3.point) * 3,
+        (p2.point - p1.point) * 3,
+        p1.point,
     };
 }
 
-planar::Bezier planar::Bezier::transform(const std::function<planar::Point<double>(const planar::Point<double> &)> &map
+size_t planar::Bezier::subdivisions(double tolerance) const {
+    auto start = (p1.point - p2.point * 2 + p3.point).magnitude();
+    auto end   = (p2.point - p3.point * 2 + p4.point).magnitude();
+
+    auto bound = 6 * std::max(start, end);
+
+    if (bound == 0) {
+        return 1;
+    }
+
+    auto count = std::ceil(std::sqrt(bound / (8 * tolerance)));
+
+    if (!(count < static_cast<double>(max_subdivisions))) {
+        return max_subdivisions;
+    }
+
+    return std::max(static_cast<size_t>(count), size_t{1});
+}
+
+void planar::Bezier::flatten(double tolerance, std::vector<Point<double>> &output) const {
+    auto count  = subdivisions(tolerance);
+    auto offset = output.size();
+
+    output.resize(offset + count + 1);
+    points(0, 1 / static_cast<double>(count), std::span(output).subspan(offset));
+
+    output.back() = p4;
+}
+
+void planar::Bezier::flatten(double tolerance, std::vector<Segment<double>> &output) const {
+    auto count = subdivisions(tolerance);
+    auto step  = 1 / static_cast<double>(count);
+
+    std::array<double, 64> ts{};
+    std::array<Point<double>, 64> chunk;
+
+    auto previous = p1;
+
+    for (size_t start = 1; start <= count; start += chunk.size()) {
+        auto size = std::min(chunk.size(), count + 1 - start);
+
+        for (size_t i = 0; i < size; ++i) {
+            ts[i] = step * static_cast<double>(start + i);
+        }
+
+        points(std::span(ts).first(size), std::span(chunk).first(size));
+
+        if (start + size > count) {
+            chunk[size - 1] = p4;
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            output.emplace_back(previous, chunk[i]);
+            previous = chunk[i];
+        }
+    }
+}
+
+planar::Vector<double> planar::Bezier::derivative(double t) const {
+    auto s = 1 - t;
+    auto d1 = p2.point - p1.point;
+    auto d2 = p3.point - p2.point;
+    auto d3 = p4.point - p3.point;
+    return (d1 * (s * s) + d2 * (2 * s * t) + d3 * (t * t)) * 3;
+}
+
+planar::Vector<double> planar::Bezier::second_derivative(double t) const {
+    auto s = 1 - t;
+    return ((p3.point - p2.point * 2 + p1.point) * s + (p4.point - p3.point * 2 + p2.point) * t) * 6;
+}
+
+double planar::Bezier::length(double start, double end) const {
+    auto middle = (start + end) / 2;
+    auto radius = (end - start) / 2;
+
+    double total = 0;
+
+    for (const auto &[node, weight] : quadrature) {
+        auto left  = derivative(middle - radius * node).magnitude();
+        auto right = derivative(middle + radius * node).magnitude();
+
+        total += weight * (left + right);
+    }
+
+    return total * radius;
+}
+
+planar::Bounds planar::Bezier::bounds() const {
+    auto [left, right] = extrema(p1.x(), p2.x(), p3.x(), p4.x());
+    auto [top, bottom] = extrema(p1.y(), p2.y(), p3.y(), p4.y());
+
+    return {left, top, right - left, bottom - top};
+}
+
+void planar::Bezier::bounds(std::span<const Bezier> curves, std::span<Bounds> output) {
+    require(output.size(), curves.size());
+
+    for (size_t i = 0; i < curves.size(); ++i) {
+        output[i] = curves[i].bounds();
+    }
+}
+
+planar::Bounds planar::Bezier::hull() const {
+    auto left   = std::min({p1.x(), p2.x(), p3.x(), p4.x()});
+    auto right  = std::max({p1.x(), p2.x(), p3.x(), p4.x()});
+    auto top    = std::min({p1.y(), p2.y(), p3.y(), p4.y()});
+    auto bottom = std::max({p1.y(), p2.y(), p3.y(), p4.y()});
+
+    return {left, top, right - left, bottom - top};
+}
+
+std::vector<std::pair<double, double>> planar::Bezier::intersections(const Bezier &other, double tolerance) const {
+    std::vector<std::pair<double, double>> output;
+    intersections(other, tolerance, output);
+    return output;
+}
+
+std::vector<std::pair<double, double>> planar::Bezier::intersections(const Segment<double> &other, double tolerance)
+    const {
+    std::vector<std::pair<double, double>> output;
+    intersections(other, tolerance, output);
+    return output;
+}
+
+std::pmr::vector<std::pair<double, double>> planar::Bezier::intersections(
+    const Bezier &other,
+    double tolerance,
+    std::pmr::memory_resource *resource
 ) const {
+    std::pmr::vector<std::pair<double, double>> output(resource);
+
+    auto stack = scratch<Candidate>(output);
+    auto hits  = scratch<std::array<double, 4>>(output);
+    auto spans = scratch<std::array<double, 4>>(output);
+
+    intersect(*this, other, tolerance, stack, hits, spans, output);
+    return output;
+}
+
+std::pmr::vector<std::pair<double, double>> planar::Bezier::intersections(
+    const Segment<double> &other,
+    double tolerance,
+    std::pmr::memory_resource *resource
+) const {
+    return intersections(line(other), tolerance, resource);
+}
+
+void planar::Bezier::intersections(
+    const Bezier &other,
+    double tolerance,
+    std::vector<std::pair<double, double>> &output
+) const {
+    auto stack = scratch<Candidate>(output);
+    auto hits  = scratch<std::array<double, 4>>(output);
+    auto spans = scratch<std::array<double, 4>>(output);
+
+    intersect(*this, other, tolerance, stack, hits, spans, output);
+}
+
+void planar::Bezier::intersections(
+    const Segment<double> &other,
+    double tolerance,
+    std::vector<std::pair<double, double>> &output
+) const {
+    intersections(line(other), tolerance, output);
+}
+
+void planar::Bezier::intersections(
+    std::span<const Bezier> others,
+    double tolerance,
+    std::vector<Intersection> &output
+) const {
+    intersect(*this, others, tolerance, output);
+}
+
+void planar::Bezier::intersections(
+    std::span<const Bezier> others,
+    double tolerance,
+    std::pmr::vector<Intersection> &output
+) const {
+    intersect(*this, others, tolerance, output);
+}
+
+std::pair<planar::Bezier, planar::Bezier> planar::Bezier::split(double t) const {
+    auto lerp = [t](const Vector<double> &a, const Vector<double> &b) {
+        return a + (b - a) * t;
+    };
+
+    auto q1 = lerp(p1.point, p2.point);
+    auto q2 = lerp(p2.point, p3.point);
+    auto q3 = lerp(p3.point, p4.point);
+
+    auto r1 = lerp(q1, q2);
+    auto r2 = lerp(q2, q3);
+
+    Point<double> middle(lerp(r1, r2));
+
     return {
-        map(p1),
-        map(p2),
-        map(p3),
-        map(p4),
+        {p1, Point<double>(q1), Point<double>(r1), middle},
+        {middle, Point<double>(r2), Point<double>(q3), p4},
     };
 }
 
-double planar::Bezier::square_error(const std::vector<Point<double>> &points) const {
-    auto copy = points;
-    std::sort(copy.begin(), copy.end());
+void planar::Bezier::split(std::span<const double> ts, std::span<Bezier> output) const {
+    require(output.size(), ts.size() + 1);
 
-    double error = 0;
+    auto size = ts.size();
 
-    for (const auto t : funky::linspace(0.0, 1.0, 100)) {
-        auto projection = point(1 - t);
+    auto remainder = *this;
+    double offset  = 0;
 
-        while (!copy.empty() && projection.x() <= copy.back().x()) {
-            error += std::pow(projection.y() - copy.back().y(), 2);
-            copy.pop_back();
-        }
+    for (size_t i = 0; i < size; ++i) {
+        auto local = offset < 1 ? (ts[i] - offset) / (1 - offset) : 0;
+
+        auto [left, right] = remainder.split(local);
+
+        output[i] = left;
+        remainder = right;
+        offset    = ts[i];
     }
 
-    return error;
+    output[size] = remainder;
+}
+
+planar::Bezier planar::Bezier::subcurve(double start, double end) const {
+    auto right = split(start).second;
+
+    if (start >= 1) {
+        return right;
+    }
+
+    return right.split((end - start) / (1 - start)).first;
+}
+
+planar::Bezier planar::Bezier::shift(const planar::Size<double> &offset) const {
+    return {
+        p1 + offset,
+        p2 + offset,
+        p3 + offset,
+        p4 + offset,
+    };
+}
+
+double planar::Bezier::square_error(const std::vector<Point<double>> &points) const {
+    return Series(points).square_error(*this);
 }
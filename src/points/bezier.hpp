@@ -1,23 +1,54 @@
 #ifndef PLANAR_POINTS_BEZIER_HPP
 #define PLANAR_POINTS_BEZIER_HPP
 
+#include "../linear/vector.hpp"
 #include "point.hpp"
+#include <array>
 #include <cstddef>
-#include <functional>
+#include <memory_resource>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace planar {
+    class Bounds;
+
     template <typename T>
     class Size;
 
+    template <typename T>
+    class Segment;
+
+    enum class Parameterization {
+        Chord,
+        Horizontal,
+    };
+
+    class Intersection {
+      public:
+        size_t index;
+        double t;
+        double u;
+
+        Intersection(size_t index, double t, double u);
+
+        bool operator==(const Intersection &rhs) const;
+        bool operator!=(const Intersection &rhs) const;
+    };
+
     class Bezier {
       public:
+        static constexpr size_t max_subdivisions = 1 << 16;
+
+        static constexpr size_t max_iterations = 1 << 20;
+
         Point<double> p1;
         Point<double> p2;
         Point<double> p3;
         Point<double> p4;
 
+        Bezier();
         Bezier(const Point<double> &p1, const Point<double> &p2, const Point<double> &p3, const Point<double> &p4);
 
         explicit Bezier(const std::vector<Point<double>> &points);
@@ -27,11 +58,78 @@ namespace planar {
 
         std::string repr() const;
 
+        double fit(
+            const std::vector<Point<double>> &points,
+            Parameterization parameterization = Parameterization::Chord,
+            size_t iterations                 = 0
+        );
+
         Point<double> point(double t) const;
 
+        void points(std::span<const double> ts, std::span<Point<double>> output) const;
+        void points(double start, double step, std::span<Point<double>> output) const;
+
+        std::array<Vector<double>, 4> coefficients() const;
+
+        size_t subdivisions(double tolerance) const;
+
+        void flatten(double tolerance, std::vector<Point<double>> &output) const;
+        void flatten(double tolerance, std::vector<Segment<double>> &output) const;
+
+        Vector<double> derivative(double t) const;
+        Vector<double> second_derivative(double t) const;
+
+        double length(double start = 0, double end = 1) const;
+
+        Bounds bounds() const;
+
+        static void bounds(std::span<const Bezier> curves, std::span<Bounds> output);
+
+        std::pair<Bezier, Bezier> split(double t) const;
+
+        void split(std::span<const double> ts, std::span<Bezier> output) const;
+
+        Bezier subcurve(double start, double end) const;
+
+        Bounds hull() const;
+
+        std::vector<std::pair<double, double>> intersections(const Bezier &other, double tolerance = 1e-9) const;
+        std::vector<std::pair<double, double>> intersections(
+            const Segment<double> &other,
+            double tolerance = 1e-9
+        ) const;
+
+        std::pmr::vector<std::pair<double, double>> intersections(
+            const Bezier &other,
+            double tolerance,
+            std::pmr::memory_resource *resource
+        ) const;
+
+        std::pmr::vector<std::pair<double, double>> intersections(
+            const Segment<double> &other,
+            double tolerance,
+            std::pmr::memory_resource *resource
+        ) const;
+
+        void intersections(const Bezier &other, double tolerance, std::vector<std::pair<double, double>> &output) const;
+
+        void intersections(
+            const Segment<double> &other,
+            double tolerance,
+            std::vector<std::pair<double, double>> &output
+        ) const;
+
+        void intersections(std::span<const Bezier> others, double tolerance, std::vector<Intersection> &output) const;
+        void intersections(
+            std::span<const Bezier> others,
+            double tolerance,
+            std::pmr::vector<Intersection> &output
+        ) const;
+
         Bezier shift(const Size<double> &offset) const;
 
-        Bezier transform(const std::function<Point<double>(const Point<double> &)> &map) const;
+        template <typename F>
+        Bezier transform(F &&map) const;
 
         double square_error(const std::vector<Point<double>> &points) const;
     };
@@ -1,7 +1,16 @@
-#include "bezier.hpp"
+#include "bezier.tpp"
+#include "../areas/bounds.hpp"
+#include "../linear/vector.tpp"
 #include "point.hpp"
-#include <funky/generics/iterables.tpp>
+#include "segment.tpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <gtest/gtest.h>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 using namespace planar;
 
@@ -36,3 +45,370 @@ TEST(Bezier, SquareError) {
     points.emplace_back(1, 0);
     EXPECT_NEAR(bezier.square_error(points), 2, 0.01);
 }
+
+TEST(Bezier, Derivative) {
+    Bezier bezier({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    EXPECT_EQ(bezier.derivative(0), Vector<double>(0, 3));
+    EXPECT_EQ(bezier.derivative(1), Vector<double>(0, -3));
+
+    EXPECT_EQ(bezier.second_derivative(0), Vector<double>(6, -6));
+    EXPECT_EQ(bezier.second_derivative(1), Vector<double>(-6, -6));
+}
+
+TEST(Bezier, Fit) {
+    std::vector<Point<double>> line({
+        {0, 0},
+        {1, 1},
+        {2, 2},
+        {3, 3}
+    });
+
+    Bezier bezier(line);
+    EXPECT_EQ(bezier.p1, Point<double>(0, 0));
+    EXPECT_EQ(bezier.p4, Point<double>(3, 3));
+    EXPECT_NEAR(bezier.fit(line), 0, 1e-9);
+
+    Bezier curve({0, 0}, {1, 3}, {3, 3}, {4, 0});
+    std::vector<Point<double>> points;
+
+    for (auto i = 0; i <= 20; ++i) {
+        points.push_back(curve.point(i / 20.0));
+    }
+
+    auto coarse  = bezier.fit(points);
+    auto refined = bezier.fit(points, Parameterization::Chord, 10);
+
+    EXPECT_LT(refined, coarse);
+    EXPECT_NEAR(refined, 0, 1e-3);
+
+    EXPECT_NEAR(bezier.p2.x(), 1, 0.05);
+    EXPECT_NEAR(bezier.p2.y(), 3, 0.05);
+    EXPECT_NEAR(bezier.p3.x(), 3, 0.05);
+    EXPECT_NEAR(bezier.p3.y(), 3, 0.05);
+}
+
+TEST(Bezier, FitHorizontal) {
+    Bezier curve({0, 0}, {1, 2}, {2, -2}, {3, 0});
+    std::vector<Point<double>> points;
+
+    for (auto i = 0; i <= 30; ++i) {
+        points.push_back(curve.point(i / 30.0));
+    }
+
+    Bezier bezier({0, 0}, {0, 0}, {0, 0}, {0, 0});
+    EXPECT_NEAR(bezier.fit(points, Parameterization::Horizontal), 0, 1e-9);
+    EXPECT_NEAR(bezier.p2.y(), 2, 1e-6);
+    EXPECT_NEAR(bezier.p3.y(), -2, 1e-6);
+}
+
+TEST(Bezier, FitDegenerate) {
+    Bezier bezier({
+        {0, 0},
+        {1, 1}
+    });
+
+    EXPECT_EQ(bezier, Bezier({0, 0}, {0, 0}, {1, 1}, {1, 1}));
+}
+
+TEST(Bezier, Points) {
+    Bezier bezier({0, 0}, {1, 3}, {3, -1}, {4, 2});
+
+    std::vector<double> ts;
+    for (auto i = 0; i <= 10; ++i) {
+        ts.push_back(i / 10.0);
+    }
+
+    std::vector<Point<double>> spanned(ts.size());
+    std::vector<Point<double>> uniform(ts.size());
+
+    bezier.points(ts, spanned);
+    bezier.points(0, 0.1, uniform);
+
+    for (size_t i = 0; i < ts.size(); ++i) {
+        auto expected = bezier.point(ts[i]);
+
+        EXPECT_NEAR(spanned[i].x(), expected.x(), 1e-12);
+        EXPECT_NEAR(spanned[i].y(), expected.y(), 1e-12);
+
+        EXPECT_NEAR(uniform[i].x(), expected.x(), 1e-12);
+        EXPECT_NEAR(uniform[i].y(), expected.y(), 1e-12);
+    }
+}
+
+TEST(Bezier, Coefficients) {
+    Bezier bezier({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    auto [a, b, c, d] = bezier.coefficients();
+
+    EXPECT_EQ(a, Vector<double>(-2, 0));
+    EXPECT_EQ(b, Vector<double>(3, -3));
+    EXPECT_EQ(c, Vector<double>(0, 3));
+    EXPECT_EQ(d, Vector<double>(0, 0));
+}
+
+TEST(Bezier, Subdivisions) {
+    EXPECT_EQ(Bezier({0, 0}, {1, 1}, {2, 2}, {3, 3}).subdivisions(0.1), 1);
+
+    Bezier bezier({0, 0}, {0, 1}, {1, 1}, {1, 0});
+    EXPECT_LT(bezier.subdivisions(0.1), bezier.subdivisions(0.001));
+    EXPECT_EQ(bezier.subdivisions(0), Bezier::max_subdivisions);
+}
+
+TEST(Bezier, Flatten) {
+    Bezier bezier({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    std::vector<Point<double>> polyline;
+    bezier.flatten(0.01, polyline);
+
+    EXPECT_EQ(polyline.size(), bezier.subdivisions(0.01) + 1);
+    EXPECT_EQ(polyline.front(), bezier.p1);
+    EXPECT_EQ(polyline.back(), bezier.p4);
+
+    for (auto i = 0; i <= 100; ++i) {
+        auto target = bezier.point(i / 100.0);
+        auto nearest = 1.0;
+
+        for (size_t j = 1; j < polyline.size(); ++j) {
+            auto start = polyline[j - 1].point;
+            auto chord = polyline[j].point - start;
+            auto along = (target.point - start).x * chord.x + (target.point - start).y * chord.y;
+            auto ratio = std::clamp(along / (chord.x * chord.x + chord.y * chord.y), 0.0, 1.0);
+
+            nearest = std::min(nearest, (start + chord * ratio - target.point).magnitude());
+        }
+
+        EXPECT_LE(nearest, 0.01);
+    }
+
+    for (auto tolerance : {0.01, 0.0001}) {
+        polyline.clear();
+        bezier.flatten(tolerance, polyline);
+
+        std::vector<Segment<double>> segments;
+        bezier.flatten(tolerance, segments);
+
+        EXPECT_EQ(segments.size(), polyline.size() - 1);
+
+        for (size_t i = 0; i < segments.size(); ++i) {
+            EXPECT_EQ(segments[i].start, polyline[i]);
+            EXPECT_EQ(segments[i].end, polyline[i + 1]);
+        }
+    }
+}
+
+TEST(Bezier, Bounds) {
+    EXPECT_EQ(Bezier({0, 0}, {1, 1}, {2, 2}, {3, 3}).bounds(), Bounds(0, 0, 3, 3));
+    EXPECT_EQ(Bezier({0, 0}, {0, 1}, {1, 1}, {1, 0}).bounds(), Bounds(0, 0, 1, 0.75));
+
+    Bezier bezier({0, 0}, {-1, 2}, {3, -2}, {2, 1});
+    auto bounds = bezier.bounds();
+
+    for (auto i = 0; i <= 1000; ++i) {
+        EXPECT_TRUE(bounds.contains(bezier.point(i / 1000.0)));
+    }
+
+    EXPECT_LT(bounds.point.x(), 0);
+    EXPECT_GT(bounds.point.x() + bounds.size.width(), 2);
+
+    std::vector<Bezier> curves({bezier, Bezier({0, 0}, {1, 1}, {2, 2}, {3, 3})});
+    std::vector<Bounds> output(curves.size());
+
+    Bezier::bounds(curves, output);
+    EXPECT_EQ(output[0], bounds);
+    EXPECT_EQ(output[1], Bounds(0, 0, 3, 3));
+
+    std::vector<Bounds> small(curves.size() - 1);
+    EXPECT_THROW(Bezier::bounds(curves, small), std::length_error);
+}
+
+TEST(Bezier, Split) {
+    Bezier bezier({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    auto [left, right] = bezier.split(0.5);
+    EXPECT_EQ(left, Bezier({0, 0}, {0, 0.5}, {0.25, 0.75}, {0.5, 0.75}));
+    EXPECT_EQ(right, Bezier({0.5, 0.75}, {0.75, 0.75}, {1, 0.5}, {1, 0}));
+
+    for (auto i = 0; i <= 10; ++i) {
+        auto t = i / 10.0;
+
+        EXPECT_NEAR(left.point(t).x(), bezier.point(t / 2).x(), 1e-12);
+        EXPECT_NEAR(left.point(t).y(), bezier.point(t / 2).y(), 1e-12);
+        EXPECT_NEAR(right.point(t).x(), bezier.point(0.5 + t / 2).x(), 1e-12);
+        EXPECT_NEAR(right.point(t).y(), bezier.point(0.5 + t / 2).y(), 1e-12);
+    }
+}
+
+TEST(Bezier, SplitMany) {
+    Bezier bezier({0, 0}, {-1, 2}, {3, -2}, {2, 1});
+
+    std::vector<double> ts({0.2, 0.5, 0.9});
+    std::vector<Bezier> pieces(ts.size() + 1, bezier);
+
+    bezier.split(ts, pieces);
+
+    std::vector<Bezier> small(ts.size());
+    EXPECT_THROW(bezier.split(ts, small), std::length_error);
+
+    std::vector<double> bounds({0, 0.2, 0.5, 0.9, 1});
+
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        auto expected = bezier.subcurve(bounds[i], bounds[i + 1]);
+
+        for (auto j = 0; j <= 4; ++j) {
+            EXPECT_NEAR(pieces[i].point(j / 4.0).x(), expected.point(j / 4.0).x(), 1e-12);
+            EXPECT_NEAR(pieces[i].point(j / 4.0).y(), expected.point(j / 4.0).y(), 1e-12);
+        }
+    }
+}
+
+TEST(Bezier, Subcurve) {
+    Bezier bezier({0, 0}, {-1, 2}, {3, -2}, {2, 1});
+    auto part = bezier.subcurve(0.25, 0.75);
+
+    for (auto i = 0; i <= 10; ++i) {
+        auto t = i / 10.0;
+
+        EXPECT_NEAR(part.point(t).x(), bezier.point(0.25 + t / 2).x(), 1e-12);
+        EXPECT_NEAR(part.point(t).y(), bezier.point(0.25 + t / 2).y(), 1e-12);
+    }
+
+    EXPECT_EQ(bezier.subcurve(0, 1), bezier);
+}
+
+TEST(Bezier, Intersections) {
+    Bezier arch({0, 0}, {0, 1}, {1, 1}, {1, 0});
+    Bezier bowl({0, 1}, {0, 0}, {1, 0}, {1, 1});
+
+    auto crossings = arch.intersections(bowl);
+    ASSERT_EQ(crossings.size(), 2);
+
+    for (const auto &[t, u] : crossings) {
+        EXPECT_NEAR(arch.point(t).x(), bowl.point(u).x(), 1e-6);
+        EXPECT_NEAR(arch.point(t).y(), bowl.point(u).y(), 1e-6);
+        EXPECT_NEAR(arch.point(t).y(), 0.5, 1e-6);
+    }
+
+    EXPECT_TRUE(arch.intersections(bowl.shift({0, 5})).empty());
+}
+
+TEST(Bezier, IntersectionsCoincident) {
+    Bezier arch({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    auto same = arch.intersections(arch);
+    ASSERT_EQ(same.size(), 2);
+    EXPECT_NEAR(same[0].first, 0, 1e-6);
+    EXPECT_NEAR(same[0].second, 0, 1e-6);
+    EXPECT_NEAR(same[1].first, 1, 1e-6);
+    EXPECT_NEAR(same[1].second, 1, 1e-6);
+
+    auto reversed = arch.intersections(Bezier(arch.p4, arch.p3, arch.p2, arch.p1));
+    ASSERT_EQ(reversed.size(), 2);
+    EXPECT_NEAR(reversed[0].first, 0, 1e-6);
+    EXPECT_NEAR(reversed[0].second, 1, 1e-6);
+    EXPECT_NEAR(reversed[1].first, 1, 1e-6);
+    EXPECT_NEAR(reversed[1].second, 0, 1e-6);
+
+    Bezier flat({0, 0}, {1, 0}, {2, 0}, {3, 0});
+
+    auto collinear = flat.intersections(Segment<double>({-1, 0}, {4, 0}));
+    ASSERT_EQ(collinear.size(), 2);
+    EXPECT_NEAR(collinear[0].first, 0, 1e-9);
+    EXPECT_NEAR(collinear[0].second, 0.2, 1e-9);
+    EXPECT_NEAR(collinear[1].first, 1, 1e-9);
+    EXPECT_NEAR(collinear[1].second, 0.8, 1e-9);
+
+    std::vector<Intersection> output;
+    arch.intersections(std::vector<Bezier>({arch, Bezier({0, 1}, {0, 0}, {1, 0}, {1, 1})}), 1e-9, output);
+
+    ASSERT_EQ(output.size(), 4);
+    EXPECT_EQ(output[0].index, 0);
+    EXPECT_EQ(output[2].index, 1);
+    EXPECT_EQ(output[3].index, 1);
+
+    Bezier far({1e12, 1e12}, {1e12, 1e12 + 1}, {1e12 + 1, 1e12 + 1}, {1e12 + 1, 1e12});
+    Bezier cross({1e12, 1e12 + 1}, {1e12, 1e12}, {1e12 + 1, 1e12}, {1e12 + 1, 1e12 + 1});
+
+    EXPECT_EQ(far.intersections(cross).size(), 2);
+}
+
+TEST(Bezier, IntersectionsSegment) {
+    Bezier arch({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    auto crossings = arch.intersections(Segment<double>({-1, 0.5}, {2, 0.5}));
+    ASSERT_EQ(crossings.size(), 2);
+
+    for (const auto &[t, u] : crossings) {
+        EXPECT_NEAR(arch.point(t).y(), 0.5, 1e-6);
+        EXPECT_NEAR(-1 + 3 * u, arch.point(t).x(), 1e-6);
+    }
+
+    EXPECT_TRUE(arch.intersections(Segment<double>({-1, 2}, {2, 2})).empty());
+}
+
+TEST(Bezier, IntersectionsOutput) {
+    Bezier arch({0, 0}, {0, 1}, {1, 1}, {1, 0});
+    Bezier bowl({0, 1}, {0, 0}, {1, 0}, {1, 1});
+
+    std::vector<std::pair<double, double>> output;
+    arch.intersections(bowl, 1e-9, output);
+    arch.intersections(Segment<double>({-1, 0.5}, {2, 0.5}), 1e-9, output);
+
+    EXPECT_EQ(output.size(), 4);
+
+    std::array<std::byte, 1 << 16> arena{};
+    std::pmr::monotonic_buffer_resource resource(arena.data(), arena.size(), std::pmr::null_memory_resource());
+
+    auto crossings = arch.intersections(bowl, 1e-9, &resource);
+    EXPECT_TRUE(std::ranges::equal(crossings, arch.intersections(bowl)));
+
+    std::pmr::vector<Intersection> many(&resource);
+    arch.intersections(std::vector<Bezier>({bowl}), 1e-9, many);
+    EXPECT_EQ(many.size(), 2);
+}
+
+TEST(Bezier, IntersectionsMany) {
+    Bezier arch({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    std::vector<Bezier> others({
+        Bezier({0, 1}, {0, 0}, {1, 0}, {1, 1}),
+        Bezier({5, 5}, {6, 5}, {6, 6}, {5, 6}),
+        Bezier({0.5, -1}, {0.5, 0}, {0.5, 1}, {0.5, 2}),
+    });
+
+    std::vector<Intersection> output;
+    arch.intersections(others, 1e-9, output);
+
+    ASSERT_EQ(output.size(), 3);
+    EXPECT_EQ(output[0].index, 0);
+    EXPECT_EQ(output[1].index, 0);
+    EXPECT_EQ(output[2].index, 2);
+
+    EXPECT_NEAR(output[2].t, 0.5, 1e-6);
+    EXPECT_NEAR(output[2].u, 7.0 / 12.0, 1e-6);
+}
+
+TEST(Bezier, Transform) {
+    Bezier curve({0, 0}, {0, 1}, {1, 1}, {1, 0});
+
+    EXPECT_EQ(
+        curve.transform([](const Point<double> &point) {
+            return point.flip_y(1).shift({1, 0});
+        }),
+        Bezier({1, 2}, {1, 1}, {2, 1}, {2, 2})
+    );
+
+    size_t calls = 0;
+
+    auto same = curve.transform([&calls](const Point<double> &point) {
+        ++calls;
+        return point;
+    });
+
+    EXPECT_EQ(same, curve);
+    EXPECT_EQ(calls, 4);
+}
+
+TEST(Bezier, TriviallyCopyable) {
+    static_assert(std::is_trivially_copyable_v<Bezier>);
+}
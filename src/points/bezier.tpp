@@ -0,0 +1,17 @@
+#ifndef PLANAR_POINTS_BEZIER_TPP
+#define PLANAR_POINTS_BEZIER_TPP
+
+#include "bezier.hpp"
+#include "point.hpp"
+
+template <typename F>
+planar::Bezier planar::Bezier::transform(F &&map) const {
+    return {
+        map(p1),
+        map(p2),
+        map(p3),
+        map(p4),
+    };
+}
+
+#endif
@@ -0,0 +1,142 @@
+#include "buffer.hpp"
+#include "../areas/bounds.hpp"
+#include "../areas/size.tpp"
+#include "../linear/transform.hpp"
+#include "../scalar/compact.tpp"
+#include "../scalar/length.hpp"
+#include "point.tpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+planar::PointBuffer::PointBuffer(std::span<const Point<double>> points) {
+    x.reserve(points.size());
+    y.reserve(points.size());
+
+    for (const auto &point : points) {
+        push_back(point);
+    }
+}
+
+bool planar::PointBuffer::operator==(const PointBuffer &rhs) const {
+    return x == rhs.x && y == rhs.y;
+}
+
+bool planar::PointBuffer::operator!=(const PointBuffer &rhs) const {
+    return !(*this == rhs);
+}
+
+planar::Point<double> planar::PointBuffer::operator[](size_t index) const {
+    return {x[index], y[index]};
+}
+
+size_t planar::PointBuffer::size() const {
+    return x.size();
+}
+
+bool planar::PointBuffer::empty() const {
+    return x.empty();
+}
+
+void planar::PointBuffer::clear() {
+    x.clear();
+    y.clear();
+}
+
+void planar::PointBuffer::push_back(const Point<double> &point) {
+    x.push_back(point.x());
+    y.push_back(point.y());
+}
+
+std::vector<planar::Point<double>> planar::PointBuffer::points() const {
+    std::vector<Point<double>> output;
+    output.reserve(size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        output.emplace_back(x[i], y[i]);
+    }
+
+    return output;
+}
+
+std::pmr::vector<planar::Point<double>> planar::PointBuffer::points(std::pmr::memory_resource *resource) const {
+    std::pmr::vector<Point<double>> output(resource);
+    output.reserve(size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        output.emplace_back(x[i], y[i]);
+    }
+
+    return output;
+}
+
+void planar::PointBuffer::points(std::span<Point<double>> output) const {
+    require(output.size(), size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        output[i] = Point<double>(x[i], y[i]);
+    }
+}
+
+void planar::PointBuffer::within(const Bounds &bounds, std::span<std::uint8_t> mask) const {
+    auto left   = bounds.point.x();
+    auto top    = bounds.point.y();
+    auto right  = left + bounds.size.width();
+    auto bottom = top + bounds.size.height();
+
+    const auto *xs = x.data();
+    const auto *ys = y.data();
+
+    require(mask.size(), size());
+
+    for (size_t i = 0; i < size(); ++i) {
+        mask[i] = static_cast<std::uint8_t>((left <= xs[i]) & (xs[i] <= right) & (top <= ys[i]) & (ys[i] <= bottom));
+    }
+}
+
+void planar::PointBuffer::within(const Bounds &bounds, std::vector<size_t> &indices) const {
+    auto left   = bounds.point.x();
+    auto top    = bounds.point.y();
+    auto right  = left + bounds.size.width();
+    auto bottom = top + bounds.size.height();
+
+    compact(size(), indices, [this, left, top, right, bottom](size_t i) {
+        return (left <= x[i]) & (x[i] <= right) & (top <= y[i]) & (y[i] <= bottom);
+    });
+}
+
+void planar::PointBuffer::shift(const Size<double> &offset) {
+    auto dx = offset.width();
+    auto dy = offset.height();
+
+    for (auto &value : x) {
+        value += dx;
+    }
+
+    for (auto &value : y) {
+        value += dy;
+    }
+}
+
+void planar::PointBuffer::scale(const Size<double> &factor) {
+    auto fx = factor.width();
+    auto fy = factor.height();
+
+    for (auto &value : x) {
+        value *= fx;
+    }
+
+    for (auto &value : y) {
+        value *= fy;
+    }
+}
+
+void planar::PointBuffer::center(const Size<double> &size) {
+    shift({-size.width() / 2, -size.height() / 2});
+}
+
+void planar::PointBuffer::transform(const Transform &transform) {
+    transform.apply(x, y);
+}
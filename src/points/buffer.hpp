@@ -0,0 +1,60 @@
+#ifndef PLANAR_POINTS_BUFFER_HPP
+#define PLANAR_POINTS_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace planar {
+    class Bounds;
+    class Transform;
+
+    template <typename T>
+    class Point;
+
+    template <typename T>
+    class Size;
+
+    class PointBuffer {
+      public:
+        std::vector<double> x;
+        std::vector<double> y;
+
+        PointBuffer() = default;
+
+        explicit PointBuffer(std::span<const Point<double>> points);
+
+        bool operator==(const PointBuffer &rhs) const;
+        bool operator!=(const PointBuffer &rhs) const;
+
+        Point<double> operator[](size_t index) const;
+
+        size_t size() const;
+
+        bool empty() const;
+
+        void clear();
+
+        void push_back(const Point<double> &point);
+
+        std::vector<Point<double>> points() const;
+        std::pmr::vector<Point<double>> points(std::pmr::memory_resource *resource) const;
+
+        void points(std::span<Point<double>> output) const;
+
+        void within(const Bounds &bounds, std::span<std::uint8_t> mask) const;
+        void within(const Bounds &bounds, std::vector<size_t> &indices) const;
+
+        void shift(const Size<double> &offset);
+
+        void scale(const Size<double> &factor);
+
+        void center(const Size<double> &size);
+
+        void transform(const Transform &transform);
+    };
+}
+
+#endif
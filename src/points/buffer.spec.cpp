@@ -0,0 +1,78 @@
+#include "buffer.hpp"
+#include "../areas/bounds.hpp"
+#include "../linear/vector.tpp"
+#include "point.tpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+using namespace planar;
+
+TEST(PointBuffer, Points) {
+    std::vector<Point<double>> points({
+        {0.0, 1.0},
+        {2.0, 3.0}
+    });
+
+    PointBuffer buffer(points);
+
+    EXPECT_EQ(buffer.size(), 2);
+    EXPECT_EQ(buffer.x, std::vector<double>({0.0, 2.0}));
+    EXPECT_EQ(buffer.y, std::vector<double>({1.0, 3.0}));
+
+    EXPECT_EQ(buffer[1], Point(2.0, 3.0));
+    EXPECT_EQ(buffer.points(), points);
+
+    std::pmr::monotonic_buffer_resource resource;
+    EXPECT_TRUE(std::ranges::equal(buffer.points(&resource), points));
+
+    std::vector<Point<double>> output(buffer.size());
+    buffer.points(output);
+    EXPECT_EQ(output, points);
+
+    std::vector<Point<double>> small(buffer.size() - 1);
+    EXPECT_THROW(buffer.points(small), std::length_error);
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(PointBuffer, Within) {
+    PointBuffer buffer(std::vector<Point<double>>({
+        {0.0, 0.0},
+        {0.5, 0.5},
+        {2.0, 0.5},
+        {1.0, 1.0}
+    }));
+
+    std::vector<std::uint8_t> mask(buffer.size());
+    buffer.within(Bounds(0.0, 0.0, 1.0, 1.0), mask);
+    EXPECT_EQ(mask, std::vector<std::uint8_t>({1, 1, 0, 1}));
+
+    std::vector<std::uint8_t> small(buffer.size() - 1);
+    EXPECT_THROW(buffer.within(Bounds(0.0, 0.0, 1.0, 1.0), small), std::length_error);
+
+    std::vector<size_t> indices({9});
+    buffer.within(Bounds(0.0, 0.0, 1.0, 1.0), indices);
+    EXPECT_EQ(indices, std::vector<size_t>({9, 0, 1, 3}));
+}
+
+TEST(PointBuffer, Transform) {
+    PointBuffer buffer(std::vector<Point<double>>({
+        {1.0, 1.0},
+        {2.0, 3.0}
+    }));
+
+    buffer.shift({1.0, 2.0});
+    EXPECT_EQ(buffer[1], Point(2.0, 3.0).shift({1.0, 2.0}));
+
+    buffer.scale({2.0, 3.0});
+    EXPECT_EQ(buffer[0], Point(2.0, 3.0).scale({2.0, 3.0}));
+
+    buffer.center({10.0, 10.0});
+    EXPECT_EQ(buffer[0], Point(4.0, 9.0).center({10.0, 10.0}));
+}
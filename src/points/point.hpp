@@ -1,62 +1,204 @@
 #ifndef PLANAR_POINTS_POINT_HPP
 #define PLANAR_POINTS_POINT_HPP
 
+#include "../areas/size.hpp"
 #include "../linear/vector.hpp"
+#include <iterator>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace planar {
-    template <typename T>
-    class Size;
-
     template <typename T>
     class Point {
       public:
         Vector<T> point;
 
-        Point();
-        Point(T x, T y);
+        constexpr Point() noexcept;
+        constexpr Point(T x, T y) noexcept;
 
-        explicit Point(const Vector<T> &point);
+        constexpr explicit Point(const Vector<T> &point) noexcept;
 
-        bool operator==(const Point<T> &rhs) const;
-        bool operator!=(const Point<T> &rhs) const;
-        bool operator<(const Point<T> &rhs) const;
-        bool operator>(const Point<T> &rhs) const;
-        bool operator<=(const Point<T> &rhs) const;
-        bool operator>=(const Point<T> &rhs) const;
+        constexpr bool operator==(const Point<T> &rhs) const noexcept;
+        constexpr bool operator!=(const Point<T> &rhs) const noexcept;
+        constexpr bool operator<(const Point<T> &rhs) const noexcept;
+        constexpr bool operator>(const Point<T> &rhs) const noexcept;
+        constexpr bool operator<=(const Point<T> &rhs) const noexcept;
+        constexpr bool operator>=(const Point<T> &rhs) const noexcept;
 
-        Point<T> operator+(const Vector<T> &rhs) const;
-        Point<T> operator-(const Vector<T> &rhs) const;
+        constexpr Point<T> operator+(const Vector<T> &rhs) const noexcept;
+        constexpr Point<T> operator-(const Vector<T> &rhs) const noexcept;
 
-        Point<T> operator+(const Size<T> &rhs) const;
-        Point<T> operator-(const Size<T> &rhs) const;
+        constexpr Point<T> operator+(const Size<T> &rhs) const noexcept;
+        constexpr Point<T> operator-(const Size<T> &rhs) const noexcept;
 
         std::string repr() const;
 
-        T x() const;
-        T y() const;
+        constexpr T x() const noexcept;
+        constexpr T y() const noexcept;
 
-        bool zero() const;
+        constexpr bool zero() const noexcept;
 
-        Point<T> scale(T factor) const;
-        Point<T> scale(const Size<T> &factor) const;
+        constexpr Point<T> scale(T factor) const noexcept;
+        constexpr Point<T> scale(const Size<T> &factor) const noexcept;
 
-        Point<T> flip(const Point<T> &origin) const;
-        Point<T> flip_x(T origin) const;
-        Point<T> flip_y(T origin) const;
+        constexpr Point<T> flip(const Point<T> &origin) const noexcept;
+        constexpr Point<T> flip_x(T origin) const noexcept;
+        constexpr Point<T> flip_y(T origin) const noexcept;
 
-        Point<T> shift(const Size<T> &size) const;
+        constexpr Point<T> shift(const Size<T> &size) const noexcept;
 
-        Point<T> center(const Size<T> &size) const;
+        constexpr Point<T> center(const Size<T> &size) const noexcept;
 
-        Point<T> center_horizontal(const Size<T> &size) const;
-        Point<T> center_vertical(const Size<T> &size) const;
+        constexpr Point<T> center_horizontal(const Size<T> &size) const noexcept;
+        constexpr Point<T> center_vertical(const Size<T> &size) const noexcept;
 
-        Size<T> projection() const;
+        constexpr Size<T> projection() const noexcept;
 
         static std::vector<Point<T>> linspace(const std::vector<T> &heights, T start, T end);
+
+        static std::pmr::vector<Point<T>> linspace(
+            std::span<const T> heights,
+            T start,
+            T end,
+            std::pmr::memory_resource *resource
+        );
+
+        static void linspace(std::span<const T> heights, T start, T end, std::span<Point<T>> output);
+
+        template <std::output_iterator<Point<T>> Iterator>
+        static Iterator linspace(std::span<const T> heights, T start, T end, Iterator output);
     };
 }
 
+template <typename T>
+constexpr planar::Point<T>::Point() noexcept : point(0, 0) {
+}
+
+template <typename T>
+constexpr planar::Point<T>::Point(T x, T y) noexcept : point(x, y) {
+}
+
+template <typename T>
+constexpr planar::Point<T>::Point(const Vector<T> &point) noexcept : point(point) {
+}
+
+template <typename T>
+constexpr bool planar::Point<T>::operator==(const Point<T> &rhs) const noexcept {
+    return point == rhs.point;
+}
+
+template <typename T>
+constexpr bool planar::Point<T>::operator!=(const Point<T> &rhs) const noexcept {
+    return point != rhs.point;
+}
+
+template <typename T>
+constexpr bool planar::Point<T>::operator<(const Point<T> &rhs) const noexcept {
+    return point < rhs.point;
+}
+
+template <typename T>
+constexpr bool planar::Point<T>::operator>(const Point<T> &rhs) const noexcept {
+    return point > rhs.point;
+}
+
+template <typename T>
+constexpr bool planar::Point<T>::operator<=(const Point<T> &rhs) const noexcept {
+    return point <= rhs.point;
+}
+
+template <typename T>
+constexpr bool planar::Point<T>::operator>=(const Point<T> &rhs) const noexcept {
+    return point >= rhs.point;
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::operator+(const Vector<T> &rhs) const noexcept {
+    return Point(point + rhs);
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::operator-(const Vector<T> &rhs) const noexcept {
+    return Point(point - rhs);
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::operator+(const Size<T> &rhs) const noexcept {
+    return Point(point + rhs.size);
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::operator-(const Size<T> &rhs) const noexcept {
+    return Point(point - rhs.size);
+}
+
+template <typename T>
+constexpr T planar::Point<T>::x() const noexcept {
+    return point.x;
+}
+
+template <typename T>
+constexpr T planar::Point<T>::y() const noexcept {
+    return point.y;
+}
+
+template <typename T>
+constexpr bool planar::Point<T>::zero() const noexcept {
+    return point.x == 0 && point.y == 0;
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::scale(T factor) const noexcept {
+    return scale({factor, factor});
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::scale(const Size<T> &factor) const noexcept {
+    return {point.x * factor.width(), point.y * factor.height()};
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::flip(const Point<T> &origin) const noexcept {
+    return {2 * origin.x() - point.x, 2 * origin.y() - point.y};
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::flip_x(T origin) const noexcept {
+    return {2 * origin - point.x, point.y};
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::flip_y(T origin) const noexcept {
+    return {point.x, 2 * origin - point.y};
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::shift(const Size<T> &size) const noexcept {
+    return {point.x + size.width(), point.y + size.height()};
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::center(const Size<T> &size) const noexcept {
+    auto width  = static_cast<T>(size.width());
+    auto height = static_cast<T>(size.height());
+    return shift({-width / 2, -height / 2});
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::center_horizontal(const Size<T> &size) const noexcept {
+    return center({size.width(), 0});
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Point<T>::center_vertical(const Size<T> &size) const noexcept {
+    return center({0, size.height()});
+}
+
+template <typename T>
+constexpr planar::Size<T> planar::Point<T>::projection() const noexcept {
+    return Size<T>(point);
+}
+
 #endif
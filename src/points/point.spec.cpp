@@ -1,6 +1,14 @@
 #include "point.tpp"
 #include "../linear/vector.tpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 using namespace planar;
 
@@ -74,3 +82,38 @@ TEST(Point, Linspace) {
     EXPECT_EQ(points[1], Point(1.0, 1.0));
     EXPECT_EQ(points[2], Point(2.0, 2.0));
 }
+
+TEST(Point, LinspaceOutput) {
+    std::vector<double> heights({0.0, 1.0, 2.0});
+
+    std::array<Point<double>, 3> buffer{};
+    Point<double>::linspace(heights, 0.0, 2.0, buffer);
+    EXPECT_TRUE(std::ranges::equal(buffer, Point<double>::linspace(heights, 0.0, 2.0)));
+
+    std::vector<Point<double>> points;
+    Point<double>::linspace(heights, 0.0, 2.0, std::back_inserter(points));
+    EXPECT_EQ(points, Point<double>::linspace(heights, 0.0, 2.0));
+
+    std::array<Point<double>, 2> small{};
+    EXPECT_THROW(Point<double>::linspace(heights, 0.0, 2.0, small), std::length_error);
+}
+
+TEST(Point, LinspaceResource) {
+    std::array<std::byte, 256> arena{};
+    std::pmr::monotonic_buffer_resource resource(arena.data(), arena.size(), std::pmr::null_memory_resource());
+
+    std::vector<double> heights({0.0, 1.0, 2.0});
+
+    auto points = Point<double>::linspace(heights, 0.0, 2.0, &resource);
+    EXPECT_EQ(points.get_allocator().resource(), &resource);
+    EXPECT_TRUE(std::ranges::equal(points, Point<double>::linspace(heights, 0.0, 2.0)));
+}
+
+TEST(Point, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Point<double>>);
+    static_assert(std::is_nothrow_default_constructible_v<Point<double>>);
+
+    static_assert(Point(1, 1).shift({2, 3}) == Point(3, 4));
+    static_assert(Point(2.0, 2.0).center({2.0, 4.0}) == Point(1.0, 0.0));
+    static_assert(Point(1, 2).flip({0, 0}).projection() == Size(-1, -2));
+}
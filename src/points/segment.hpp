@@ -2,6 +2,7 @@
 #define PLANAR_POINTS_SEGMENT_HPP
 
 #include "point.hpp"
+#include <string>
 
 namespace planar {
     template <typename T>
@@ -10,15 +11,35 @@ namespace planar {
         Point<T> start;
         Point<T> end;
 
-        Segment(const Point<T> &start, const Point<T> &end);
+        constexpr Segment(const Point<T> &start, const Point<T> &end) noexcept;
 
-        bool operator==(const Segment<T> &rhs) const;
-        bool operator!=(const Segment<T> &rhs) const;
+        constexpr bool operator==(const Segment<T> &rhs) const noexcept;
+        constexpr bool operator!=(const Segment<T> &rhs) const noexcept;
 
         std::string repr() const;
 
-        Point<T> midpoint() const;
+        constexpr Point<T> midpoint() const noexcept;
     };
 }
 
+template <typename T>
+constexpr planar::Segment<T>::Segment(const Point<T> &start, const Point<T> &end) noexcept : start(start)
+                                                                                          , end(end) {
+}
+
+template <typename T>
+constexpr bool planar::Segment<T>::operator==(const Segment<T> &rhs) const noexcept {
+    return start == rhs.start && end == rhs.end;
+}
+
+template <typename T>
+constexpr bool planar::Segment<T>::operator!=(const Segment<T> &rhs) const noexcept {
+    return start != rhs.start || end != rhs.end;
+}
+
+template <typename T>
+constexpr planar::Point<T> planar::Segment<T>::midpoint() const noexcept {
+    return {(start.x() + end.x()) / 2, (start.y() + end.y()) / 2};
+}
+
 #endif
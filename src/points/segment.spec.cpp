@@ -1,6 +1,7 @@
 #include "segment.tpp"
 #include "point.hpp"
 #include <gtest/gtest.h>
+#include <type_traits>
 
 using namespace planar;
 
@@ -11,3 +12,9 @@ TEST(Segment, Midpoint) {
 TEST(Segment, Repr) {
     EXPECT_EQ(Segment<double>({0.0, 0.0}, {1.0, 1.0}).repr(), "{start: {x: 0, y: 0}, end: {x: 1, y: 1}}");
 }
+
+TEST(Segment, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Segment<double>>);
+
+    static_assert(Segment<int>({0, 0}, {4, 2}).midpoint() == Point(2, 1));
+}
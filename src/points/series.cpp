@@ -0,0 +1,145 @@
+#include "series.hpp"
+#include "../scalar/instrument.hpp"
+#include "../scalar/length.hpp"
+#include "bezier.hpp"
+#include "point.tpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace {
+    using Basis = std::array<std::array<double, planar::Series::samples>, 4>;
+
+    const Basis &basis() {
+        static const Basis table = [] {
+            Basis weights{};
+
+            for (size_t j = 0; j < planar::Series::samples; ++j) {
+                auto t = 1 - static_cast<double>(j) / static_cast<double>(planar::Series::samples - 1);
+                auto s = 1 - t;
+
+                weights[0][j] = s * s * s;
+                weights[1][j] = 3 * s * s * t;
+                weights[2][j] = 3 * s * t * t;
+                weights[3][j] = t * t * t;
+            }
+
+            return weights;
+        }();
+
+        return table;
+    }
+}
+
+planar::Series::Series(const std::vector<Point<double>> &points) {
+    PLANAR_MEASURE("Series::Series");
+    PLANAR_COUNT(points.size());
+
+    std::pmr::vector<Point<double>> sorted(points.begin(), points.end(), Instrument::resource());
+    std::sort(sorted.begin(), sorted.end());
+
+    xs.reserve(sorted.size());
+    ys.reserve(sorted.size());
+
+    for (const auto &point : sorted) {
+        xs.push_back(point.x());
+        ys.push_back(point.y());
+    }
+}
+
+size_t planar::Series::size() const {
+    return xs.size();
+}
+
+bool planar::Series::empty() const {
+    return xs.empty();
+}
+
+double planar::Series::merge(const double *x, const double *y, size_t stride) const {
+    double error = 0;
+    auto remaining = xs.size();
+
+    for (size_t j = 0; j < samples && remaining > 0; ++j) {
+        auto px = x[j * stride];
+        auto py = y[j * stride];
+
+        while (remaining > 0 && px <= xs[remaining - 1]) {
+            auto delta = py - ys[remaining - 1];
+            error += delta * delta;
+            --remaining;
+        }
+    }
+
+    return error;
+}
+
+double planar::Series::square_error(const Bezier &curve) const {
+    PLANAR_MEASURE("Series::square_error");
+    PLANAR_COUNT(1);
+
+    const auto &weights = basis();
+
+    std::array<double, samples> x{};
+    std::array<double, samples> y{};
+
+    for (size_t j = 0; j < samples; ++j) {
+        x[j] = weights[0][j] * curve.p1.x() + weights[1][j] * curve.p2.x() + weights[2][j] * curve.p3.x() +
+               weights[3][j] * curve.p4.x();
+        y[j] = weights[0][j] * curve.p1.y() + weights[1][j] * curve.p2.y() + weights[2][j] * curve.p3.y() +
+               weights[3][j] * curve.p4.y();
+    }
+
+    return merge(x.data(), y.data(), 1);
+}
+
+void planar::Series::square_error(std::span<const Bezier> curves, std::span<double> errors) const {
+    PLANAR_MEASURE("Series::square_error");
+    PLANAR_COUNT(curves.size());
+
+    require(errors.size(), curves.size());
+
+    const auto &weights = basis();
+
+    std::array<double, lanes * 4> cx{};
+    std::array<double, lanes * 4> cy{};
+
+    std::array<double, samples * lanes> x{};
+    std::array<double, samples * lanes> y{};
+
+    for (size_t start = 0; start < curves.size(); start += lanes) {
+        auto count = std::min(lanes, curves.size() - start);
+
+        for (size_t c = 0; c < count; ++c) {
+            const auto &curve = curves[start + c];
+
+            cx[c]             = curve.p1.x();
+            cx[lanes + c]     = curve.p2.x();
+            cx[2 * lanes + c] = curve.p3.x();
+            cx[3 * lanes + c] = curve.p4.x();
+
+            cy[c]             = curve.p1.y();
+            cy[lanes + c]     = curve.p2.y();
+            cy[2 * lanes + c] = curve.p3.y();
+            cy[3 * lanes + c] = curve.p4.y();
+        }
+
+        for (size_t j = 0; j < samples; ++j) {
+            auto w0 = weights[0][j];
+            auto w1 = weights[1][j];
+            auto w2 = weights[2][j];
+            auto w3 = weights[3][j];
+
+            for (size_t c = 0; c < lanes; ++c) {
+                x[j * lanes + c] = w0 * cx[c] + w1 * cx[lanes + c] + w2 * cx[2 * lanes + c] + w3 * cx[3 * lanes + c];
+                y[j * lanes + c] = w0 * cy[c] + w1 * cy[lanes + c] + w2 * cy[2 * lanes + c] + w3 * cy[3 * lanes + c];
+            }
+        }
+
+        for (size_t c = 0; c < count; ++c) {
+            errors[start + c] = merge(x.data() + c, y.data() + c, lanes);
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef PLANAR_POINTS_SERIES_HPP
+#define PLANAR_POINTS_SERIES_HPP
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace planar {
+    class Bezier;
+
+    template <typename T>
+    class Point;
+
+    class Series {
+      private:
+        std::vector<double> xs;
+        std::vector<double> ys;
+
+        double merge(const double *x, const double *y, size_t stride) const;
+
+      public:
+        static constexpr size_t samples = 100;
+        static constexpr size_t lanes   = 8;
+
+        explicit Series(const std::vector<Point<double>> &points);
+
+        size_t size() const;
+
+        bool empty() const;
+
+        double square_error(const Bezier &curve) const;
+
+        void square_error(std::span<const Bezier> curves, std::span<double> errors) const;
+    };
+}
+
+#endif
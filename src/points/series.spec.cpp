@@ -0,0 +1,48 @@
+#include "series.hpp"
+#include "../linear/vector.tpp"
+#include "bezier.hpp"
+#include "point.tpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace planar;
+
+TEST(Series, Size) {
+    EXPECT_TRUE(Series({}).empty());
+    EXPECT_EQ(Series({{0, 1}, {1, 0}}).size(), 2);
+}
+
+TEST(Series, SquareError) {
+    Bezier bezier({0, 0}, {0, 0}, {1, 1}, {1, 1});
+
+    EXPECT_NEAR(Series({{0, 1}}).square_error(bezier), 1, 0.01);
+    EXPECT_NEAR(Series({{1, 0}, {0, 1}}).square_error(bezier), 2, 0.01);
+}
+
+TEST(Series, Batch) {
+    Series series({
+        {0.0, 0.0},
+        {0.5, 1.0},
+        {1.0, 0.5},
+        {2.0, 2.0},
+        {3.0, 0.0}
+    });
+
+    std::vector<Bezier> curves;
+
+    for (auto i = 0; i < 19; ++i) {
+        auto offset = static_cast<double>(i) / 4;
+        curves.emplace_back(Point(0.0, 0.0), Point(1.0, offset), Point(2.0, -offset), Point(3.0, 0.0));
+    }
+
+    std::vector<double> errors(curves.size());
+    series.square_error(curves, errors);
+
+    for (size_t i = 0; i < curves.size(); ++i) {
+        EXPECT_DOUBLE_EQ(errors[i], series.square_error(curves[i]));
+    }
+
+    std::vector<double> small(curves.size() - 1);
+    EXPECT_THROW(series.square_error(curves, small), std::length_error);
+}
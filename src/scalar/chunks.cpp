@@ -0,0 +1,25 @@
+#include "chunks.hpp"
+#include "slice.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+
+planar::Chunks::Chunks(size_t size, size_t minimum, size_t threads) : size(size), count(0) {
+    if (size == 0) {
+        return;
+    }
+
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    count = std::clamp(size / std::max(minimum, size_t{1}), size_t{1}, std::min(threads, limit));
+}
+
+planar::Slice planar::Chunks::operator[](size_t index) const {
+    auto base      = size / count;
+    auto remainder = size % count;
+
+    auto start = index * base + std::min(index, remainder);
+    return {start, start + base + (index < remainder ? 1 : 0)};
+}
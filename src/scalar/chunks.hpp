@@ -0,0 +1,24 @@
+#ifndef PLANAR_SCALAR_CHUNKS_HPP
+#define PLANAR_SCALAR_CHUNKS_HPP
+
+#include "slice.hpp"
+#include <cstddef>
+
+namespace planar {
+    class Chunks {
+      public:
+        static constexpr size_t limit = 64;
+
+        size_t size;
+        size_t count;
+
+        Chunks(size_t size, size_t minimum, size_t threads = 0);
+
+        Slice operator[](size_t index) const;
+
+        template <typename F>
+        void run(F &&task) const;
+    };
+}
+
+#endif
@@ -0,0 +1,47 @@
+#include "chunks.tpp"
+#include "slice.hpp"
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace planar;
+
+TEST(Chunks, Count) {
+    EXPECT_EQ(Chunks(0, 10, 4).count, 0);
+    EXPECT_EQ(Chunks(5, 10, 4).count, 1);
+    EXPECT_EQ(Chunks(25, 10, 4).count, 2);
+    EXPECT_EQ(Chunks(1000, 10, 4).count, 4);
+    EXPECT_EQ(Chunks(1000, 1, 1000).count, Chunks::limit);
+}
+
+TEST(Chunks, Slices) {
+    Chunks chunks(10, 1, 3);
+
+    EXPECT_EQ(chunks[0], Slice(0, 4));
+    EXPECT_EQ(chunks[1], Slice(4, 7));
+    EXPECT_EQ(chunks[2], Slice(7, 10));
+}
+
+TEST(Chunks, Run) {
+    Chunks chunks(1000, 10, 4);
+
+    std::vector<size_t> totals(chunks.count);
+    std::atomic<size_t> calls = 0;
+
+    chunks.run([&totals, &calls](size_t index, const Slice &range) {
+        for (auto i = range.start; i < range.end; ++i) {
+            totals[index] += i;
+        }
+
+        ++calls;
+    });
+
+    size_t total = 0;
+    for (auto value : totals) {
+        total += value;
+    }
+
+    EXPECT_EQ(calls, chunks.count);
+    EXPECT_EQ(total, 999 * 1000 / 2);
+}
@@ -0,0 +1,36 @@
+#ifndef PLANAR_SCALAR_CHUNKS_TPP
+#define PLANAR_SCALAR_CHUNKS_TPP
+
+#include "chunks.hpp"
+#include "slice.hpp"
+#include <array>
+#include <cstddef>
+#include <thread>
+
+template <typename F>
+void planar::Chunks::run(F &&task) const {
+    if (count == 0) {
+        return;
+    }
+
+    if (count == 1) {
+        task(0, (*this)[0]);
+        return;
+    }
+
+    std::array<std::thread, limit - 1> workers;
+
+    for (size_t i = 1; i < count; ++i) {
+        workers[i - 1] = std::thread([&task, i, this] {
+            task(i, (*this)[i]);
+        });
+    }
+
+    task(0, (*this)[0]);
+
+    for (size_t i = 1; i < count; ++i) {
+        workers[i - 1].join();
+    }
+}
+
+#endif
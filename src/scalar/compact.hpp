@@ -0,0 +1,12 @@
+#ifndef PLANAR_SCALAR_COMPACT_HPP
+#define PLANAR_SCALAR_COMPACT_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace planar {
+    template <typename F>
+    void compact(size_t size, std::vector<size_t> &indices, F &&predicate);
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef PLANAR_SCALAR_COMPACT_TPP
+#define PLANAR_SCALAR_COMPACT_TPP
+
+#include "compact.hpp"
+#include <cstddef>
+#include <vector>
+
+template <typename F>
+void planar::compact(size_t size, std::vector<size_t> &indices, F &&predicate) {
+    auto offset = indices.size();
+    indices.resize(offset + size);
+
+    auto *output = indices.data() + offset;
+    size_t found = 0;
+
+    for (size_t i = 0; i < size; ++i) {
+        output[found] = i;
+        found += static_cast<size_t>(predicate(i));
+    }
+
+    indices.resize(offset + found);
+}
+
+#endif
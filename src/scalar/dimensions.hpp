@@ -10,12 +10,19 @@ namespace planar {
         size_t rows;
         size_t cols;
 
-        Dimensions(size_t rows, size_t cols);
+        constexpr Dimensions(size_t rows, size_t cols) noexcept;
 
-        bool operator==(const Dimensions &rhs) const;
+        constexpr bool operator==(const Dimensions &rhs) const noexcept;
 
         std::string repr() const;
     };
 }
 
+constexpr planar::Dimensions::Dimensions(size_t rows, size_t cols) noexcept : rows(rows), cols(cols) {
+}
+
+constexpr bool planar::Dimensions::operator==(const Dimensions &rhs) const noexcept {
+    return rows == rhs.rows && cols == rhs.cols;
+}
+
 #endif
@@ -1,5 +1,6 @@
 #include "dimensions.hpp"
 #include <gtest/gtest.h>
+#include <type_traits>
 
 using namespace planar;
 
@@ -11,3 +12,9 @@ TEST(Dimensions, Operators) {
 TEST(Dimensions, Repr) {
     EXPECT_EQ(Dimensions(1, 1).repr(), "{rows: 1, cols: 1}");
 }
+
+TEST(Dimensions, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Dimensions>);
+
+    static_assert(Dimensions(2, 3) == Dimensions(2, 3));
+}
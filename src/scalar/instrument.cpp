@@ -0,0 +1,174 @@
+#include "instrument.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <fmt/format.h>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    thread_local uint64_t allocated = 0;
+
+    class Registry;
+
+    struct Global {
+        std::mutex mutex;
+        std::vector<Registry *> live;
+        std::map<std::string, planar::Measure> retired;
+    };
+
+    Global &global() {
+        static Global instance;
+        return instance;
+    }
+
+    class Registry {
+      public:
+        std::mutex mutex;
+        std::map<std::string, planar::Counter, std::less<>> counters;
+
+        Registry() {
+            auto &shared = global();
+            std::scoped_lock lock(shared.mutex);
+            shared.live.push_back(this);
+        }
+
+        Registry(const Registry &)            = delete;
+        Registry &operator=(const Registry &) = delete;
+
+        ~Registry() {
+            auto &shared = global();
+            std::scoped_lock lock(shared.mutex, mutex);
+
+            for (const auto &[name, counter] : counters) {
+                shared.retired[name] += counter.measure();
+            }
+
+            shared.live.erase(std::ranges::find(shared.live, this));
+        }
+    };
+
+    Registry &local() {
+        thread_local Registry registry;
+        return registry;
+    }
+}
+
+planar::Measure &planar::Measure::operator+=(const Measure &rhs) {
+    calls += rhs.calls;
+    elements += rhs.elements;
+    allocations += rhs.allocations;
+    nanoseconds += rhs.nanoseconds;
+    return *this;
+}
+
+bool planar::Measure::operator==(const Measure &rhs) const {
+    return calls == rhs.calls && elements == rhs.elements && allocations == rhs.allocations &&
+           nanoseconds == rhs.nanoseconds;
+}
+
+std::string planar::Measure::repr() const {
+    return fmt::format(
+        "{{calls: {}, elements: {}, allocations: {}, nanoseconds: {}}}",
+        calls,
+        elements,
+        allocations,
+        nanoseconds
+    );
+}
+
+planar::Measure planar::Counter::measure() const {
+    return {
+        calls.load(std::memory_order_relaxed),
+        elements.load(std::memory_order_relaxed),
+        allocations.load(std::memory_order_relaxed),
+        nanoseconds.load(std::memory_order_relaxed),
+    };
+}
+
+void planar::Counter::reset() {
+    calls.store(0, std::memory_order_relaxed);
+    elements.store(0, std::memory_order_relaxed);
+    allocations.store(0, std::memory_order_relaxed);
+    nanoseconds.store(0, std::memory_order_relaxed);
+}
+
+planar::Allocations::Allocations(std::pmr::memory_resource *upstream) : upstream(upstream) {
+}
+
+uint64_t planar::Allocations::count() {
+    return allocated;
+}
+
+void *planar::Allocations::do_allocate(size_t bytes, size_t alignment) {
+    ++allocated;
+    return upstream->allocate(bytes, alignment);
+}
+
+void planar::Allocations::do_deallocate(void *pointer, size_t bytes, size_t alignment) {
+    upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool planar::Allocations::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+
+planar::Counter &planar::Instrument::counter(std::string_view name) {
+    auto &registry = local();
+    std::scoped_lock lock(registry.mutex);
+
+    if (auto match = registry.counters.find(name); match != registry.counters.end()) {
+        return match->second;
+    }
+
+    return registry.counters.try_emplace(std::string(name)).first->second;
+}
+
+std::map<std::string, planar::Measure> planar::Instrument::snapshot() {
+    auto &shared = global();
+    std::scoped_lock lock(shared.mutex);
+
+    auto totals = shared.retired;
+
+    for (auto *registry : shared.live) {
+        std::scoped_lock inner(registry->mutex);
+
+        for (const auto &[name, counter] : registry->counters) {
+            totals[name] += counter.measure();
+        }
+    }
+
+    return totals;
+}
+
+void planar::Instrument::reset() {
+    auto &shared = global();
+    std::scoped_lock lock(shared.mutex);
+
+    shared.retired.clear();
+
+    for (auto *registry : shared.live) {
+        std::scoped_lock inner(registry->mutex);
+
+        for (auto &[name, counter] : registry->counters) {
+            counter.reset();
+        }
+    }
+}
+
+std::pmr::memory_resource *planar::Instrument::resource() {
+#ifdef PLANAR_INSTRUMENT
+    static auto *instance = new Allocations(std::pmr::new_delete_resource());
+    return instance;
+#else
+    return std::pmr::new_delete_resource();
+#endif
+}
+
+uint64_t planar::Instrument::allocations() {
+    return Allocations::count();
+}
@@ -0,0 +1,130 @@
+#ifndef PLANAR_SCALAR_INSTRUMENT_HPP
+#define PLANAR_SCALAR_INSTRUMENT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+namespace planar {
+    class Measure {
+      public:
+        uint64_t calls       = 0;
+        uint64_t elements    = 0;
+        uint64_t allocations = 0;
+        uint64_t nanoseconds = 0;
+
+        Measure &operator+=(const Measure &rhs);
+
+        bool operator==(const Measure &rhs) const;
+
+        std::string repr() const;
+    };
+
+    class Counter {
+      public:
+        std::atomic<uint64_t> calls       = 0;
+        std::atomic<uint64_t> elements    = 0;
+        std::atomic<uint64_t> allocations = 0;
+        std::atomic<uint64_t> nanoseconds = 0;
+
+        void call(uint64_t duration);
+
+        void count(uint64_t n);
+
+        void allocate(uint64_t n);
+
+        Measure measure() const;
+
+        void reset();
+
+      private:
+        static void add(std::atomic<uint64_t> &field, uint64_t n);
+    };
+
+    class Timer {
+      public:
+        Counter &counter;
+        std::chrono::steady_clock::time_point start;
+        uint64_t allocated;
+
+        explicit Timer(Counter &counter);
+
+        Timer(const Timer &)            = delete;
+        Timer &operator=(const Timer &) = delete;
+
+        ~Timer();
+    };
+
+    class Allocations : public std::pmr::memory_resource {
+      public:
+        explicit Allocations(std::pmr::memory_resource *upstream);
+
+        static uint64_t count();
+
+      private:
+        std::pmr::memory_resource *upstream;
+
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+    };
+
+    class Instrument {
+      public:
+        static Counter &counter(std::string_view name);
+
+        static std::map<std::string, Measure> snapshot();
+
+        static std::pmr::memory_resource *resource();
+
+        static uint64_t allocations();
+
+        static void reset();
+    };
+}
+
+inline void planar::Counter::add(std::atomic<uint64_t> &field, uint64_t n) {
+    field.store(field.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+inline void planar::Counter::call(uint64_t duration) {
+    add(calls, 1);
+    add(nanoseconds, duration);
+}
+
+inline void planar::Counter::count(uint64_t n) {
+    add(elements, n);
+}
+
+inline void planar::Counter::allocate(uint64_t n) {
+    add(allocations, n);
+}
+
+inline planar::Timer::Timer(Counter &counter)
+    : counter(counter)
+    , start(std::chrono::steady_clock::now())
+    , allocated(Instrument::allocations()) {
+}
+
+inline planar::Timer::~Timer() {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    counter.call(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    counter.allocate(Instrument::allocations() - allocated);
+}
+
+#ifdef PLANAR_INSTRUMENT
+#define PLANAR_MEASURE(name)                                                                   \
+    static thread_local planar::Counter &planar_counter = planar::Instrument::counter(name); \
+    planar::Timer planar_timer(planar_counter)
+#define PLANAR_COUNT(n) planar_counter.count(n)
+#else
+#define PLANAR_MEASURE(name) static_cast<void>(0)
+#define PLANAR_COUNT(n) static_cast<void>(0)
+#endif
+
+#endif
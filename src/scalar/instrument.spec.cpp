@@ -0,0 +1,97 @@
+#include "instrument.hpp"
+#include "../points/bezier.hpp"
+#include "../points/point.tpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace planar;
+
+TEST(Measure, Add) {
+    Measure measure{1, 2, 3, 4};
+    measure += {1, 1, 1, 1};
+
+    EXPECT_EQ(measure, Measure({2, 3, 4, 5}));
+}
+
+TEST(Measure, Repr) {
+    EXPECT_EQ(Measure({1, 2, 3, 4}).repr(), "{calls: 1, elements: 2, allocations: 3, nanoseconds: 4}");
+}
+
+TEST(Counter, Measure) {
+    Counter counter;
+
+    counter.call(10);
+    counter.call(5);
+    counter.count(100);
+    counter.allocate(2);
+
+    EXPECT_EQ(counter.measure(), Measure({2, 100, 2, 15}));
+
+    counter.reset();
+    EXPECT_EQ(counter.measure(), Measure());
+}
+
+TEST(Timer, Call) {
+    Counter counter;
+
+    {
+        Timer timer(counter);
+    }
+
+    EXPECT_EQ(counter.measure().calls, 1);
+}
+
+TEST(Timer, Allocations) {
+    Counter counter;
+
+    {
+        Timer timer(counter);
+        auto *resource = Instrument::resource();
+        resource->deallocate(resource->allocate(16), 16);
+    }
+
+#ifdef PLANAR_INSTRUMENT
+    EXPECT_EQ(counter.measure().allocations, 1);
+#else
+    EXPECT_EQ(counter.measure().allocations, 0);
+#endif
+}
+
+TEST(Instrument, Counter) {
+    EXPECT_EQ(&Instrument::counter("Instrument::counter"), &Instrument::counter("Instrument::counter"));
+}
+
+TEST(Instrument, Snapshot) {
+    Instrument::reset();
+
+    Instrument::counter("Instrument::snapshot").count(1);
+
+    std::thread worker([] {
+        Instrument::counter("Instrument::snapshot").count(2);
+    });
+
+    worker.join();
+
+    EXPECT_EQ(Instrument::snapshot()["Instrument::snapshot"].elements, 3);
+
+    Instrument::reset();
+    EXPECT_EQ(Instrument::snapshot()["Instrument::snapshot"].elements, 0);
+}
+
+TEST(Instrument, Macros) {
+    Instrument::reset();
+
+    Bezier curve;
+    curve.fit({{0, 0}, {1, 1}, {2, 4}, {3, 9}});
+
+    auto totals = Instrument::snapshot();
+
+#ifdef PLANAR_INSTRUMENT
+    EXPECT_EQ(totals["Bezier::fit"].calls, 1);
+    EXPECT_EQ(totals["Bezier::fit"].elements, 4);
+    EXPECT_GT(totals["Bezier::fit"].allocations, 0);
+#else
+    EXPECT_FALSE(totals.contains("Bezier::fit"));
+#endif
+}
@@ -0,0 +1,18 @@
+#ifndef PLANAR_SCALAR_LENGTH_HPP
+#define PLANAR_SCALAR_LENGTH_HPP
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace planar {
+    // Span overloads that write one result per input throw std::length_error
+    // when the output is shorter than the result. Elements past the result are
+    // left untouched.
+    inline void require(size_t available, size_t required) {
+        if (available < required) {
+            throw std::length_error("Output span is smaller than the result");
+        }
+    }
+}
+
+#endif
@@ -9,10 +9,17 @@ namespace planar {
         size_t start;
         size_t end;
 
-        Slice(size_t start, size_t end);
+        constexpr Slice(size_t start, size_t end) noexcept;
 
-        bool operator==(const Slice &rhs) const;
+        constexpr bool operator==(const Slice &rhs) const noexcept;
     };
 }
 
+constexpr planar::Slice::Slice(size_t start, size_t end) noexcept : start(start), end(end) {
+}
+
+constexpr bool planar::Slice::operator==(const Slice &rhs) const noexcept {
+    return start == rhs.start && end == rhs.end;
+}
+
 #endif
@@ -1,5 +1,6 @@
 #include "slice.hpp"
 #include <gtest/gtest.h>
+#include <type_traits>
 
 using namespace planar;
 
@@ -7,3 +8,9 @@ TEST(Slice, Operators) {
     EXPECT_FALSE(Slice(0, 0) == Slice(1, 1));
     EXPECT_TRUE(Slice(1, 1) == Slice(1, 1));
 }
+
+TEST(Slice, Constexpr) {
+    static_assert(std::is_trivially_copyable_v<Slice>);
+
+    static_assert(Slice(1, 2) == Slice(1, 2));
+}